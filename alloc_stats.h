@@ -0,0 +1,109 @@
+#pragma once
+
+#include <malloc.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <new>
+
+typedef struct {
+    size_t allocs;
+    size_t frees;
+    size_t bytes;
+    // Net of what was freed since counting started, so it can go negative
+    // when blocks allocated before are freed
+    ptrdiff_t in_use;
+    ptrdiff_t peak_in_use;
+} alloc_stats_t;
+
+// Heap accounting for the whole process: every operator new and delete, and
+// the malloc() fallback of make_packet(), once the program has installed the
+// counting operators with QHS_COUNTING_OPERATOR_NEW and turned counting on.
+// Sizes are what the allocator actually handed out (malloc_usable_size()),
+// so frees balance allocations exactly.
+inline std::atomic<bool> alloc_stats_enabled{false};
+inline std::atomic<size_t> alloc_stats_allocs{0};
+inline std::atomic<size_t> alloc_stats_frees{0};
+inline std::atomic<size_t> alloc_stats_bytes{0};
+inline std::atomic<ptrdiff_t> alloc_stats_in_use{0};
+inline std::atomic<ptrdiff_t> alloc_stats_peak{0};
+
+inline void alloc_stats_count_alloc(void *p) {
+    if (p == NULL || !alloc_stats_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    ptrdiff_t size = malloc_usable_size(p);
+    alloc_stats_allocs.fetch_add(1, std::memory_order_relaxed);
+    alloc_stats_bytes.fetch_add(size, std::memory_order_relaxed);
+    ptrdiff_t in_use = alloc_stats_in_use.fetch_add(size, std::memory_order_relaxed) + size;
+    ptrdiff_t peak = alloc_stats_peak.load(std::memory_order_relaxed);
+    while (in_use > peak &&
+           !alloc_stats_peak.compare_exchange_weak(peak, in_use, std::memory_order_relaxed)) {
+    }
+}
+
+inline void alloc_stats_count_free(void *p) {
+    if (p == NULL || !alloc_stats_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    alloc_stats_frees.fetch_add(1, std::memory_order_relaxed);
+    alloc_stats_in_use.fetch_sub(malloc_usable_size(p), std::memory_order_relaxed);
+}
+
+inline void *alloc_stats_malloc(size_t size) {
+    void *p = malloc(size);
+    alloc_stats_count_alloc(p);
+    return p;
+}
+
+inline void alloc_stats_free(void *p) {
+    alloc_stats_count_free(p);
+    free(p);
+}
+
+inline alloc_stats_t alloc_stats() {
+    return {
+        .allocs = alloc_stats_allocs.load(std::memory_order_relaxed),
+        .frees = alloc_stats_frees.load(std::memory_order_relaxed),
+        .bytes = alloc_stats_bytes.load(std::memory_order_relaxed),
+        .in_use = alloc_stats_in_use.load(std::memory_order_relaxed),
+        .peak_in_use = alloc_stats_peak.load(std::memory_order_relaxed),
+    };
+}
+
+// Starts a new peak from what is in use now
+inline void alloc_stats_reset_peak() {
+    alloc_stats_peak.store(alloc_stats_in_use.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+}
+
+// Replaces the global operator new and delete with counting ones. Expand
+// once, at file scope, in the translation unit holding main(). They are
+// kept out of line so GCC does not see new paired with free(). Running out
+// of memory aborts, as std::bad_alloc cannot be thrown with -fno-exceptions.
+#define QHS_COUNTING_OPERATOR_NEW                                                       \
+    __attribute__((noinline)) void *operator new(size_t size) {                         \
+        void *p = malloc(size ? size : 1);                                              \
+        if (p == NULL) abort();                                                         \
+        alloc_stats_count_alloc(p);                                                     \
+        return p;                                                                       \
+    }                                                                                   \
+    void *operator new[](size_t size) { return operator new(size); }                    \
+    void *operator new(size_t size, const std::nothrow_t&) noexcept {                   \
+        void *p = malloc(size ? size : 1);                                              \
+        alloc_stats_count_alloc(p);                                                     \
+        return p;                                                                       \
+    }                                                                                   \
+    void *operator new[](size_t size, const std::nothrow_t& tag) noexcept {             \
+        return operator new(size, tag);                                                 \
+    }                                                                                   \
+    __attribute__((noinline)) void operator delete(void *p) noexcept {                  \
+        alloc_stats_free(p);                                                            \
+    }                                                                                   \
+    void operator delete[](void *p) noexcept { operator delete(p); }                    \
+    void operator delete(void *p, size_t) noexcept { operator delete(p); }              \
+    void operator delete[](void *p, size_t) noexcept { operator delete(p); }            \
+    void operator delete(void *p, const std::nothrow_t&) noexcept { operator delete(p); } \
+    void operator delete[](void *p, const std::nothrow_t&) noexcept { operator delete(p); }
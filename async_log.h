@@ -0,0 +1,198 @@
+#pragma once
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "mpsc_ring.h"
+
+#define QHS_LOG_DEBUG 0
+#define QHS_LOG_INFO 1
+#define QHS_LOG_WARN 2
+#define QHS_LOG_ERROR 3
+
+// Records below this level are compiled out, arguments included. Build with
+// -DQHS_LOG_LEVEL=QHS_LOG_DEBUG to get the raw event dumps.
+#ifndef QHS_LOG_LEVEL
+#define QHS_LOG_LEVEL QHS_LOG_INFO
+#endif
+
+#define ASYNC_LOG_QUEUE_SIZE 256
+#define ASYNC_LOG_MESSAGE_SIZE 248
+
+typedef struct {
+    uint8_t level;
+    char message[ASYNC_LOG_MESSAGE_SIZE];
+} async_log_record_t;
+
+class AsyncLogger;
+inline AsyncLogger& async_logger();
+
+// Log records are formatted on the calling thread into a fixed-size record
+// and pushed into a lock-free ring, so logging never blocks on stderr. A
+// background thread, started with the first record, writes them out; it is
+// joined and the ring drained when the program exits. Records that do not
+// fit into the ring are dropped and counted.
+//
+// With nothing to write the thread sleeps on a futex (std::atomic::wait)
+// and is only woken by a push that finds it asleep, so an idle logger costs
+// no wakeups.
+//
+// The logger is never destroyed, HAL callback threads may still log while
+// the program exits.
+class AsyncLogger {
+public:
+    AsyncLogger() = default;
+
+    // Stops the background thread and writes out what is left
+    void shutdown() {
+        std::lock_guard<std::mutex> lock(mStartLock);
+        if (mStarted.load(std::memory_order_relaxed) && !mStop.exchange(true)) {
+            wake();
+            mThread.join();
+            drain();
+        }
+    }
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    void vlog(uint8_t level, const char* fmt, va_list args) {
+        async_log_record_t record;
+        record.level = level;
+        vsnprintf(record.message, sizeof(record.message), fmt, args);
+        push(record);
+    }
+
+    // `prefix` followed by `data` in hex, truncated to fit one record
+    void hex(uint8_t level, const char* prefix, const uint8_t* data, size_t len) {
+        static const char digits[] = "0123456789abcdef";
+        async_log_record_t record;
+        record.level = level;
+
+        int n = snprintf(record.message, sizeof(record.message), "%s (len %zu):", prefix, len);
+        size_t pos = n < (int) sizeof(record.message) ? n : sizeof(record.message) - 1;
+        for (size_t i = 0; i < len && pos + 4 < sizeof(record.message); i++) {
+            record.message[pos++] = ' ';
+            record.message[pos++] = digits[data[i] >> 4];
+            record.message[pos++] = digits[data[i] & 0xf];
+        }
+        record.message[pos] = '\0';
+        push(record);
+    }
+
+private:
+    void push(const async_log_record_t& record) {
+        mRing.push(record);
+        // Pairs with the fence in run(): either this sees the thread asleep
+        // or the thread sees the record
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (mSleeping.load(std::memory_order_relaxed)) {
+            wake();
+        }
+        if (!mStarted.load(std::memory_order_acquire)) {
+            start();
+        }
+    }
+
+    // Only marked started once the thread exists, under the lock shutdown()
+    // takes too, so it never sees a started logger without a thread to join
+    void start() {
+        std::lock_guard<std::mutex> lock(mStartLock);
+        if (!mStarted.load(std::memory_order_relaxed)) {
+            mThread = std::thread([this] { run(); });
+            atexit([] { async_logger().shutdown(); });
+            mStarted.store(true, std::memory_order_release);
+        }
+    }
+
+    void run() {
+        while (!mStop.load(std::memory_order_relaxed)) {
+            drain();
+
+            uint32_t wakeups = mWakeups.load(std::memory_order_acquire);
+            mSleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (mRing.empty() && !mStop.load(std::memory_order_relaxed)) {
+                mWakeups.wait(wakeups, std::memory_order_relaxed);
+            }
+            mSleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void wake() {
+        mWakeups.fetch_add(1, std::memory_order_release);
+        mWakeups.notify_one();
+    }
+
+    // Writes out what is queued. Returns whether there was anything.
+    bool drain() {
+        static const char levels[] = "DIWE";
+        async_log_record_t record;
+        bool any = false;
+        while (mRing.pop(record)) {
+            fprintf(stderr, "%c %s\n", levels[record.level & 3], record.message);
+            any = true;
+        }
+        size_t dropped = mRing.dropped();
+        if (dropped != mReportedDropped) {
+            fprintf(stderr, "W %zu log records dropped\n", dropped - mReportedDropped);
+            mReportedDropped = dropped;
+        }
+        return any;
+    }
+
+    MpscRing<async_log_record_t, ASYNC_LOG_QUEUE_SIZE> mRing;
+    std::mutex mStartLock;
+    std::atomic<bool> mStarted{false};
+    std::atomic<bool> mStop{false};
+    std::atomic<bool> mSleeping{false};
+    std::atomic<uint32_t> mWakeups{0};
+    std::thread mThread;
+    size_t mReportedDropped = 0;
+};
+
+inline AsyncLogger& async_logger() {
+    static AsyncLogger* logger = new AsyncLogger();
+    return *logger;
+}
+
+__attribute__((format(printf, 2, 3)))
+inline void async_log(uint8_t level, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    async_logger().vlog(level, fmt, args);
+    va_end(args);
+}
+
+#if QHS_LOG_LEVEL <= QHS_LOG_DEBUG
+#define QHS_LOGD(...) async_log(QHS_LOG_DEBUG, __VA_ARGS__)
+#define QHS_LOGD_HEX(prefix, data, len) async_logger().hex(QHS_LOG_DEBUG, prefix, data, len)
+#else
+#define QHS_LOGD(...) do { } while (0)
+#define QHS_LOGD_HEX(prefix, data, len) do { } while (0)
+#endif
+
+#if QHS_LOG_LEVEL <= QHS_LOG_INFO
+#define QHS_LOGI(...) async_log(QHS_LOG_INFO, __VA_ARGS__)
+#else
+#define QHS_LOGI(...) do { } while (0)
+#endif
+
+#if QHS_LOG_LEVEL <= QHS_LOG_WARN
+#define QHS_LOGW(...) async_log(QHS_LOG_WARN, __VA_ARGS__)
+#else
+#define QHS_LOGW(...) do { } while (0)
+#endif
+
+#if QHS_LOG_LEVEL <= QHS_LOG_ERROR
+#define QHS_LOGE(...) async_log(QHS_LOG_ERROR, __VA_ARGS__)
+#else
+#define QHS_LOGE(...) do { } while (0)
+#endif
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#define CHROME_TRACE_DEFAULT_CAPACITY 65536
+
+// Records HCI transactions in memory and writes them out as Chrome trace
+// JSON, which chrome://tracing and ui.perfetto.dev open directly.
+//
+// Any thread may record: a slot is claimed with one atomic increment and
+// published with a release store, so binder callbacks never wait on the
+// reader. Events past the capacity are counted and dropped. Nothing is
+// recorded unless a tracer has been installed with chrome_trace_start().
+class ChromeTracer {
+public:
+    typedef std::chrono::steady_clock clock;
+
+    explicit ChromeTracer(size_t capacity)
+        : mEvents(new Event[capacity]), mCapacity(capacity), mStart(clock::now()) {}
+
+    ChromeTracer(const ChromeTracer&) = delete;
+    ChromeTracer& operator=(const ChromeTracer&) = delete;
+
+    // A point in time ("ph":"i"), or with `dur` a span ("ph":"X") that
+    // started at `start`. `name` must be a string literal.
+    void record(const char* name, clock::time_point start, clock::duration dur,
+                uint8_t evt, uint16_t opcode, uint16_t len, uint8_t status) {
+        size_t index = mNext.fetch_add(1, std::memory_order_relaxed);
+        if (index >= mCapacity) {
+            return;
+        }
+        Event& e = mEvents[index];
+        e.name = name;
+        e.ts_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(start - mStart).count();
+        e.dur_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(dur).count();
+        e.tid = thread_id();
+        e.evt = evt;
+        e.opcode = opcode;
+        e.len = len;
+        e.status = status;
+        e.ready.store(true, std::memory_order_release);
+    }
+
+    size_t dropped() const {
+        size_t next = mNext.load(std::memory_order_relaxed);
+        return next > mCapacity ? next - mCapacity : 0;
+    }
+
+    // Writes every event recorded so far. Events still being recorded by
+    // another thread are left out.
+    void write(FILE* out) const {
+        size_t count = std::min(mNext.load(std::memory_order_relaxed), mCapacity);
+        int pid = getpid();
+        bool first = true;
+
+        fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+        for (size_t i = 0; i < count; i++) {
+            const Event& e = mEvents[i];
+            if (!e.ready.load(std::memory_order_acquire)) continue;
+
+            fprintf(out, "%s{\"name\":\"%s\",\"cat\":\"hci\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,",
+                    first ? "" : ",\n", e.name, pid, e.tid, e.ts_ns / 1e3);
+            if (e.dur_ns > 0) {
+                fprintf(out, "\"ph\":\"X\",\"dur\":%.3f,", e.dur_ns / 1e3);
+            } else {
+                fprintf(out, "\"ph\":\"i\",\"s\":\"t\",");
+            }
+            fprintf(out, "\"args\":{\"event\":\"0x%02x\",\"opcode\":\"0x%04x\",\"len\":%u,\"status\":\"0x%02x\"}}",
+                    e.evt, e.opcode, e.len, e.status);
+            first = false;
+        }
+        fprintf(out, "\n],\"otherData\":{\"dropped\":%zu}}\n", dropped());
+    }
+
+private:
+    struct Event {
+        std::atomic<bool> ready{false};
+        const char* name;
+        int64_t ts_ns;
+        int64_t dur_ns;
+        int tid;
+        uint8_t evt;
+        uint16_t opcode;
+        uint16_t len;
+        uint8_t status;
+    };
+
+    static int thread_id() {
+        static thread_local int tid = syscall(SYS_gettid);
+        return tid;
+    }
+
+    std::unique_ptr<Event[]> mEvents;
+    size_t mCapacity;
+    clock::time_point mStart;
+    std::atomic<size_t> mNext{0};
+};
+
+inline std::atomic<ChromeTracer*> chrome_tracer{nullptr};
+
+inline void chrome_trace_start(size_t capacity = CHROME_TRACE_DEFAULT_CAPACITY) {
+    chrome_tracer.store(new ChromeTracer(capacity), std::memory_order_release);
+}
+
+// Writes the trace to `path`. The tracer stays installed: HAL callbacks may
+// still be recording into it.
+inline int chrome_trace_write(const char* path) {
+    ChromeTracer* tracer = chrome_tracer.load(std::memory_order_acquire);
+    if (tracer == nullptr) {
+        return 0;
+    }
+    FILE* out = fopen(path, "w");
+    if (out == NULL) {
+        return -1;
+    }
+    tracer->write(out);
+    return fclose(out);
+}
+
+inline void chrome_trace_instant(const char* name, uint8_t evt, uint16_t opcode, uint16_t len,
+                                 uint8_t status) {
+    ChromeTracer* tracer = chrome_tracer.load(std::memory_order_acquire);
+    if (tracer != nullptr) {
+        tracer->record(name, ChromeTracer::clock::now(), ChromeTracer::clock::duration::zero(),
+                       evt, opcode, len, status);
+    }
+}
+
+// Records the lifetime of the object as a span
+class ChromeTraceSpan {
+public:
+    explicit ChromeTraceSpan(const char* name, uint16_t opcode = 0)
+        : mTracer(chrome_tracer.load(std::memory_order_acquire)), mName(name), mOpcode(opcode) {
+        if (mTracer != nullptr) mStart = ChromeTracer::clock::now();
+    }
+
+    ~ChromeTraceSpan() {
+        if (mTracer != nullptr) {
+            mTracer->record(mName, mStart, ChromeTracer::clock::now() - mStart, 0, mOpcode, 0, 0);
+        }
+    }
+
+    ChromeTraceSpan(const ChromeTraceSpan&) = delete;
+    ChromeTraceSpan& operator=(const ChromeTraceSpan&) = delete;
+
+private:
+    ChromeTracer* mTracer;
+    const char* mName;
+    uint16_t mOpcode;
+    ChromeTracer::clock::time_point mStart;
+};
@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+"""Generates bt_compid_data.h from the Bluetooth SIG company identifiers.
+
+Usage: gen_bt_compid.py company_identifiers.yaml [bt_compid_data.h [bt_compid_check.cpp]]
+
+company_identifiers.yaml is assigned_numbers/company_identifiers/ from
+https://bitbucket.org/bluetooth-SIG/public. Every name is stored once in a
+single string pool, including names that are the tail of a longer one. The
+pool is indexed by a dense offset array and by a list of the IDs sorted by
+name. The result is checked against the input before anything is written.
+
+bt_compid_check.cpp holds a static_assert for every entry of the YAML, so
+compiling it runs bt_compid_name(), bt_compid_find() and bt_compid_prefix()
+themselves against the input. Android.bp builds both files from the YAML
+and the check as the bt_compid_check host test.
+"""
+
+import re
+import sys
+
+INTERNAL = 0xFFFF
+INTERNAL_NAME = "internal use"
+UNASSIGNED = "not assigned"
+
+
+def parse(path):
+    """The {id: name} pairs of the YAML file. It has one fixed layout, so a
+    full YAML parser is not needed."""
+    entries = {}
+    value = None
+    with open(path, encoding="utf-8") as f:
+        for lineno, line in enumerate(f, 1):
+            m = re.match(r"\s*-?\s*value:\s*(0x[0-9A-Fa-f]+|\d+)\s*$", line)
+            if m:
+                value = int(m.group(1), 0)
+                continue
+            m = re.match(r"\s*name:\s*(.*?)\s*$", line)
+            if not m:
+                continue
+            name = m.group(1)
+            if name.startswith("'") and name.endswith("'"):
+                name = name[1:-1].replace("''", "'")
+            elif name.startswith('"') and name.endswith('"'):
+                name = name[1:-1].replace('\\"', '"').replace("\\\\", "\\")
+            if value is None:
+                sys.exit(f"{path}:{lineno}: name without a value")
+            if value >= INTERNAL or value in entries:
+                sys.exit(f"{path}:{lineno}: bad or duplicate ID 0x{value:04x}")
+            entries[value] = name
+            value = None
+    if not entries:
+        sys.exit(f"{path}: no company identifiers")
+    entries[INTERNAL] = INTERNAL_NAME
+    return entries
+
+
+def build_pool(entries):
+    """The pool as a list of names and the pool offset of every name"""
+    names = sorted(set(entries.values()), key=lambda n: n.encode()[::-1], reverse=True)
+    # Reverse-sorted, a name that is the tail of others directly follows them
+    container = {}
+    last = None
+    for name in names:
+        if last is not None and last.endswith(name.encode()):
+            container[name] = last.decode()
+        else:
+            last = name.encode()
+
+    pool = [UNASSIGNED]
+    offsets = {UNASSIGNED: 0}
+    used = len(UNASSIGNED.encode()) + 1
+    for compid in sorted(entries):
+        name = entries[compid]
+        if name in offsets or name in container:
+            continue
+        pool.append(name)
+        offsets[name] = used
+        used += len(name.encode()) + 1
+    for name, outer in container.items():
+        offsets[name] = offsets[outer] + len(outer.encode()) - len(name.encode())
+    return pool, offsets, used
+
+
+def sort_key(compid, entries):
+    # What bt_compid_compare() does: ASCII case folded, bytes unsigned
+    return (entries[compid].encode().lower(), compid)
+
+
+def check(entries, pool, offsets, dense, index):
+    """Reads every ID back the way bt_compid_name() does"""
+    data = b"".join(name.encode() + b"\0" for name in pool)
+
+    def lookup(compid):
+        offset = dense[compid] if compid < len(dense) else offsets[UNASSIGNED]
+        if compid == INTERNAL:
+            offset = offsets[INTERNAL_NAME]
+        return data[offset:data.index(b"\0", offset)].decode()
+
+    for compid, name in entries.items():
+        if lookup(compid) != name:
+            sys.exit(f"0x{compid:04x} reads back as {lookup(compid)!r}, not {name!r}")
+    for compid in range(len(dense)):
+        if compid not in entries and lookup(compid) != UNASSIGNED:
+            sys.exit(f"unassigned 0x{compid:04x} reads back as {lookup(compid)!r}")
+    if sorted(index) != sorted(entries):
+        sys.exit("name index does not hold every ID once")
+    keys = [sort_key(compid, entries) for compid in index]
+    if keys != sorted(keys):
+        sys.exit("name index is not sorted")
+
+
+def c_string(name):
+    return '"' + name.replace("\\", "\\\\").replace('"', '\\"') + '\\0"'
+
+
+def c_literal(name):
+    return '"' + name.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+# Prefixes whose matches the check spells out in full, plus the empty one
+CHECK_PREFIXES = ["Qualcomm", "Apple", "Cambridge Silicon", "no such company"]
+
+
+def check_source(entries, index):
+    """static_asserts of every (ID, name) pair against the C++ lookups"""
+    folded = {}
+    for compid in sorted(entries):
+        folded.setdefault(entries[compid].encode().lower(), compid)
+
+    out = []
+    out.append("// Generated by gen_bt_compid.py together with bt_compid_data.h, do not edit.")
+    out.append("// Compiling it checks the lookups against every entry of the YAML, the")
+    out.append("// program itself has nothing left to do.")
+    out.append("")
+    out.append("#include <string_view>")
+    out.append("")
+    out.append('#include "bt_compidstr.h"')
+    out.append("")
+    out.append("constexpr bool name_is(int compid, std::string_view name) {")
+    out.append("    return bt_compid_name(compid) == name;")
+    out.append("}")
+    out.append("")
+    out.append("template <size_t N>")
+    out.append("constexpr bool prefix_is(const char *prefix, const uint16_t (&expected)[N]) {")
+    out.append("    const uint16_t *ids = nullptr;")
+    out.append("    if (bt_compid_prefix(prefix, &ids) != N) return false;")
+    out.append("    for (size_t i = 0; i < N; i++) {")
+    out.append("        if (ids[i] != expected[i]) return false;")
+    out.append("    }")
+    out.append("    return true;")
+    out.append("}")
+    out.append("")
+    out.append("// Every assigned ID, by ID and back by name. Names assigned more than")
+    out.append("// once, ignoring case, are found under their lowest ID.")
+    for compid in sorted(entries):
+        name = c_literal(entries[compid])
+        out.append(f"static_assert(name_is({compid}, {name}));")
+        out.append(f"static_assert(bt_compid_find({name}) == {folded[entries[compid].encode().lower()]});")
+    out.append("")
+    out.append("// Gaps and IDs past the table")
+    dense_count = max(compid for compid in entries if compid != INTERNAL) + 1
+    gaps = [compid for compid in range(dense_count) if compid not in entries]
+    for compid in gaps + [dense_count, INTERNAL - 1, -1]:
+        out.append(f"static_assert(name_is({compid}, {c_literal(UNASSIGNED)}));")
+    out.append(f"static_assert(bt_compid_find({c_literal('no such company')}) == -1);")
+    out.append("")
+    out.append("// Prefix lookups return their matches in name order")
+    out.append("static_assert([] {")
+    out.append("    const uint16_t *ids = nullptr;")
+    out.append(f'    return bt_compid_prefix("", &ids) == {len(entries)} && ids == bt_compid_index;')
+    out.append("}());")
+    for i, prefix in enumerate(CHECK_PREFIXES):
+        key = prefix.encode().lower()
+        matches = [compid for compid in index if entries[compid].encode().lower().startswith(key)]
+        if matches:
+            out.append(f"constexpr uint16_t prefix_{i}[] = {{{', '.join(map(str, matches))}}};")
+            out.append(f"static_assert(prefix_is({c_literal(prefix)}, prefix_{i}));")
+        else:
+            out.append("static_assert([] {")
+            out.append("    const uint16_t *ids = nullptr;")
+            out.append(f"    return bt_compid_prefix({c_literal(prefix)}, &ids) == 0;")
+            out.append("}());")
+    out.append("")
+    out.append("int main() {")
+    out.append("    return 0;")
+    out.append("}")
+    return "\n".join(out) + "\n"
+
+
+def c_array(values, indent="    ", per_line=12):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    if len(sys.argv) not in (2, 3, 4):
+        sys.exit(__doc__.split("\n\n")[1])
+    entries = parse(sys.argv[1])
+
+    pool, offsets, pool_size = build_pool(entries)
+    dense_count = max(compid for compid in entries if compid != INTERNAL) + 1
+    dense = [offsets[entries.get(compid, UNASSIGNED)] for compid in range(dense_count)]
+    index = sorted(entries, key=lambda compid: sort_key(compid, entries))
+    check(entries, pool, offsets, dense, index)
+
+    out = []
+    out.append("// Generated by gen_bt_compid.py from the Bluetooth SIG")
+    out.append("// company_identifiers.yaml, do not edit.")
+    out.append("")
+    out.append("#pragma once")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append(f"#define BT_COMPID_INTERNAL {INTERNAL}")
+    out.append(f"#define BT_COMPID_DENSE_COUNT {dense_count}")
+    out.append(f"#define BT_COMPID_COUNT {len(entries)}")
+    out.append(f"#define BT_COMPID_POOL_SIZE {pool_size + 1}")
+    out.append("")
+    out.append("// Every name once, NUL terminated. Offset 0 is what unassigned IDs get.")
+    out.append("inline constexpr char bt_compid_pool[BT_COMPID_POOL_SIZE] =")
+    out.extend("    " + c_string(name) for name in pool)
+    out[-1] += ";"
+    out.append("")
+    out.append("// Pool offset of the name of every ID below BT_COMPID_DENSE_COUNT")
+    out.append("inline constexpr uint32_t bt_compid_offsets[BT_COMPID_DENSE_COUNT] = {")
+    out.append(c_array(dense))
+    out.append("};")
+    out.append("")
+    out.append(f"inline constexpr uint32_t bt_compid_internal_offset = {offsets[INTERNAL_NAME]};")
+    out.append("")
+    out.append("// Every assigned ID, sorted by name ignoring ASCII case, then by ID")
+    out.append("inline constexpr uint16_t bt_compid_index[BT_COMPID_COUNT] = {")
+    out.append(c_array(index))
+    out.append("};")
+    text = "\n".join(out) + "\n"
+
+    if len(sys.argv) >= 3:
+        with open(sys.argv[2], "w", encoding="utf-8") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    if len(sys.argv) == 4:
+        with open(sys.argv[3], "w", encoding="utf-8") as f:
+            f.write(check_source(entries, index))
+    print(f"{len(entries)} IDs, {len(pool)} names in {pool_size} bytes", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
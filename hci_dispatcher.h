@@ -0,0 +1,399 @@
+#pragma once
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "async_log.h"
+#include "hci_parser.h"
+#include "hci_transport.h"
+
+#define HCI_MAX_PENDING_COMMANDS 8
+#define HCI_MAX_COMMAND_PARAMS 255
+#define HCI_UNSOLICITED_QUEUE_SIZE 16
+
+// Pending commands that do not answer with a sub-opcode
+#define HCI_NO_SUB_OPCODE -1
+
+// A command that timed out keeps its slot for this many times its timeout
+// (at least HCI_ABANDONED_MIN_MS) in case its answer still shows up
+#define HCI_ABANDONED_RECLAIM_FACTOR 4
+#define HCI_ABANDONED_MIN_MS 1000
+
+class HciDispatcher;
+
+// Handle to the completion of one submitted command. Waiting on it pumps the
+// dispatcher, so other commands' responses and unsolicited events read in
+// the meantime are routed to their own owners rather than lost.
+class HciCommandFuture {
+public:
+    HciCommandFuture() : mDispatcher(nullptr), mSlot(0), mGeneration(0), mRejected(false) {}
+
+    bool valid() const { return mDispatcher != nullptr; }
+    bool ready() const;
+
+    // Whether get() failed because the controller rejected the command with
+    // a Command Status, e.g. a vendor command it does not know
+    bool rejected() const { return mRejected; }
+
+    // Waits up to `to` milliseconds (negative waits forever) for the
+    // Command Complete or failed Command Status of this command. Returns 0
+    // with the event in *event, or -1 with errno set to ETIMEDOUT, or EIO if
+    // the controller rejected the command (then rejected() is set and the
+    // Command Status is in *event). *round_trip, if given, receives
+    // the time from putting the command on the wire to reading its answer.
+    int get(PacketRef* event, int to, std::chrono::nanoseconds* round_trip = nullptr);
+
+private:
+    friend class HciDispatcher;
+
+    HciCommandFuture(HciDispatcher* dispatcher, unsigned slot, uint32_t generation)
+        : mDispatcher(dispatcher), mSlot(slot), mGeneration(generation), mRejected(false) {}
+
+    HciDispatcher* mDispatcher;
+    unsigned mSlot;
+    uint32_t mGeneration;
+    bool mRejected;
+};
+
+// Matches Command Complete and Command Status events to the command that
+// caused them, by opcode and, for QBCE vendor commands, by the sub-opcode
+// echoed after the status byte. Commands with the same key complete in the
+// order they were sent. Everything else lands in a small unsolicited queue.
+//
+// Sending is paced by the Num_HCI_Command_Packets credits the controller
+// reports in every Command Complete/Status: as many commands are put on the
+// wire as it allows, the rest wait in their slot until credits come back.
+//
+// With the event filter enabled, the kernel only queues Command Complete and
+// Command Status events on the socket, narrowed to a single opcode whenever
+// every command in flight shares it.
+class HciDispatcher {
+public:
+    // The host may assume one credit until the controller says otherwise
+    // (Volume 4, Part E, 4.4)
+    explicit HciDispatcher(int dd) : mDd(dd), mCredits(1) {}
+
+    HciDispatcher(const HciDispatcher&) = delete;
+    HciDispatcher& operator=(const HciDispatcher&) = delete;
+
+    // Queues a command, sending it right away if the controller has a free
+    // command buffer, and returns a future for its completion. The future is
+    // invalid if the command could not be sent or every slot is in use. An
+    // older queued command that fails to go out meanwhile fails its own
+    // future instead.
+    HciCommandFuture submit(uint16_t ogf, uint16_t ocf, uint8_t plen, uint8_t* params,
+                            int sub_opcode = HCI_NO_SUB_OPCODE) {
+        reclaimAbandoned();
+        unsigned slot;
+        for (slot = 0; slot < HCI_MAX_PENDING_COMMANDS; slot++) {
+            if (!mPending[slot].used) break;
+        }
+        if (slot == HCI_MAX_PENDING_COMMANDS) {
+            errno = EBUSY;
+            return HciCommandFuture();
+        }
+
+        Pending& p = mPending[slot];
+        p.used = true;
+        p.sent = false;
+        p.done = false;
+        p.abandoned = false;
+        p.generation++;
+        p.sequence = mSequence++;
+        p.opcode = (ogf << 10) | ocf;
+        p.sub_opcode = sub_opcode;
+        p.plen = plen;
+        if (plen > 0) memcpy(p.params, params, plen);
+        p.event.reset();
+
+        flush();
+        if (!p.used) {
+            errno = p.send_errno;
+            return HciCommandFuture();
+        }
+        return HciCommandFuture(this, slot, p.generation);
+    }
+
+    // Commands on the wire that have not been answered yet
+    unsigned inFlight() const {
+        unsigned n = 0;
+        for (auto& p : mPending) {
+            if (p.used && p.sent && !p.done) n++;
+        }
+        return n;
+    }
+
+    unsigned credits() const { return mCredits; }
+
+    // Hands event filtering to the dispatcher. Returns -1 with errno set if
+    // the socket refused the filter.
+    int enableEventFilter(bool vendor_events) {
+        mFilterEnabled = true;
+        mVendorEvents = vendor_events;
+        mFilterOpcode = 0;
+        return hci_filter_commands(mDd, mFilterOpcode, mVendorEvents);
+    }
+
+    // Reads one event and routes it. Returns 0, or -1 with errno set when
+    // the read failed or timed out.
+    int pump(int to) {
+        ChromeTraceSpan span("wait_event");
+        PacketRef event;
+        if (hci_read_event(mDd, &event, to) < 0) {
+            return -1;
+        }
+        route(event);
+        return 0;
+    }
+
+    // Pops the oldest event no pending command claimed.
+    bool nextUnsolicited(PacketRef* event) {
+        if (mUnsolicitedHead == mUnsolicitedTail) {
+            return false;
+        }
+        *event = std::move(mUnsolicited[mUnsolicitedHead++ % HCI_UNSOLICITED_QUEUE_SIZE]);
+        return true;
+    }
+
+    size_t unsolicitedDropped() const { return mUnsolicitedDropped; }
+
+private:
+    friend class HciCommandFuture;
+
+    struct Pending {
+        bool used = false;
+        bool sent = false;
+        bool done = false;
+        bool rejected = false;
+        bool abandoned = false;
+        int send_errno = 0;
+        uint32_t generation = 0;
+        uint32_t credit_updates = 0;  // mCreditUpdates when it was sent
+        uint32_t sequence = 0;
+        uint16_t opcode = 0;
+        int sub_opcode = HCI_NO_SUB_OPCODE;
+        uint8_t plen = 0;
+        uint8_t params[HCI_MAX_COMMAND_PARAMS];
+        PacketRef event;
+        std::chrono::steady_clock::time_point sent_at;
+        std::chrono::steady_clock::time_point done_at;
+        std::chrono::steady_clock::time_point reclaim_at;
+    };
+
+    // Sends queued commands, oldest first, while credits last. A command
+    // that fails to send gives up its slot, so its future fails with EIO.
+    void flush() {
+        while (mCredits > 0) {
+            Pending* next = nullptr;
+            for (auto& p : mPending) {
+                if (!p.used || p.sent) continue;
+                if (next == nullptr || (int32_t) (p.sequence - next->sequence) < 0) {
+                    next = &p;
+                }
+            }
+            if (next == nullptr) {
+                break;
+            }
+
+            // The filter must admit the answer before the command goes out
+            next->sent = true;
+            updateFilter();
+            next->sent_at = std::chrono::steady_clock::now();
+            next->credit_updates = mCreditUpdates;
+            if (hci_send_cmd(mDd, next->opcode >> 10, next->opcode & 0x3ff, next->plen,
+                             next->params) < 0) {
+                next->send_errno = errno;
+                next->used = false;
+                continue;
+            }
+            mCredits--;
+        }
+    }
+
+    void route(const PacketRef& event) {
+        const uint8_t* data = event.data();
+        size_t len = event.size();
+        Pending* p = nullptr;
+
+        if (len >= 6 && data[0] == HCI_COMMAND_COMPLETE_EVT) {
+            // event code, length, credits, opcode, status, [sub-opcode]
+            mCredits = data[2];
+            mCreditUpdates++;
+            uint16_t opcode = data[3] | (data[4] << 8);
+            int sub_opcode = len >= 7 ? data[6] : HCI_NO_SUB_OPCODE;
+            p = findPending(opcode, sub_opcode);
+            if (p != nullptr) p->rejected = false;
+        } else if (len >= 6 && data[0] == HCI_COMMAND_STATUS_EVT) {
+            // event code, length, status, credits, opcode
+            mCredits = data[3];
+            mCreditUpdates++;
+            uint16_t opcode = data[4] | (data[5] << 8);
+            // A successful Command Status is followed by the real completion
+            if (data[2] != HCI_SUCCESS) {
+                p = findPending(opcode, HCI_NO_SUB_OPCODE);
+                if (p != nullptr) p->rejected = true;
+            }
+        }
+
+        if (p != nullptr && p->abandoned) {
+            p->used = false;
+        } else if (p != nullptr) {
+            p->done = true;
+            p->done_at = std::chrono::steady_clock::now();
+            p->event = event;
+        } else {
+            queueUnsolicited(event);
+        }
+
+        // Errors surface on the futures of the commands that failed to send
+        reclaimAbandoned();
+        flush();
+        updateFilter();
+    }
+
+    // Narrows the kernel filter to the opcode all commands on the wire share,
+    // or widens it to any opcode when they differ. With nothing on the wire
+    // the filter is left alone until the next command is sent. A failure
+    // only costs wakeups, the dispatcher still sorts the events itself.
+    void updateFilter() {
+        if (!mFilterEnabled) {
+            return;
+        }
+
+        uint16_t opcode = 0;
+        bool first = true;
+        for (auto& p : mPending) {
+            if (!p.used || !p.sent || p.done) continue;
+            if (first) {
+                opcode = p.opcode;
+                first = false;
+            } else if (p.opcode != opcode) {
+                opcode = 0;
+                break;
+            }
+        }
+
+        if (!first && opcode != mFilterOpcode) {
+            mFilterOpcode = opcode;
+            hci_filter_commands(mDd, mFilterOpcode, mVendorEvents);
+        }
+    }
+
+    // Gives up on timed-out commands whose answer never came. An answer
+    // arriving later still lands in the unsolicited queue. The credit such a
+    // command took only comes back here if the controller has not reported
+    // its credits since: every Command Complete/Status carries the absolute
+    // count, which already reflects the lost command.
+    void reclaimAbandoned() {
+        auto now = std::chrono::steady_clock::now();
+        for (auto& p : mPending) {
+            if (p.used && p.abandoned && now >= p.reclaim_at) {
+                p.used = false;
+                if (p.credit_updates == mCreditUpdates) mCredits++;
+            }
+        }
+    }
+
+    void queueUnsolicited(const PacketRef& event) {
+
+        if (mUnsolicitedTail - mUnsolicitedHead == HCI_UNSOLICITED_QUEUE_SIZE) {
+            mUnsolicitedHead++;
+            mUnsolicitedDropped++;
+        }
+        mUnsolicited[mUnsolicitedTail++ % HCI_UNSOLICITED_QUEUE_SIZE] = event;
+    }
+
+    // Oldest outstanding command with this opcode. The sub-opcode is only
+    // compared when the command registered one and the event carries it.
+    Pending* findPending(uint16_t opcode, int sub_opcode) {
+        Pending* found = nullptr;
+        for (auto& p : mPending) {
+            if (!p.used || !p.sent || p.done || p.opcode != opcode) continue;
+            if (p.sub_opcode != HCI_NO_SUB_OPCODE && sub_opcode != HCI_NO_SUB_OPCODE &&
+                p.sub_opcode != sub_opcode) continue;
+            if (found == nullptr || (int32_t) (p.sequence - found->sequence) < 0) {
+                found = &p;
+            }
+        }
+        return found;
+    }
+
+    Pending* lookup(unsigned slot, uint32_t generation) {
+        Pending& p = mPending[slot];
+        return p.used && p.generation == generation ? &p : nullptr;
+    }
+
+    int mDd;
+    unsigned mCredits;
+    uint32_t mCreditUpdates = 0;  // Command Complete/Status events seen
+    bool mFilterEnabled = false;
+    bool mVendorEvents = false;
+    uint16_t mFilterOpcode = 0;
+    uint32_t mSequence = 0;
+    Pending mPending[HCI_MAX_PENDING_COMMANDS];
+    PacketRef mUnsolicited[HCI_UNSOLICITED_QUEUE_SIZE];
+    size_t mUnsolicitedHead = 0;
+    size_t mUnsolicitedTail = 0;
+    size_t mUnsolicitedDropped = 0;
+};
+
+inline bool HciCommandFuture::ready() const {
+    auto p = mDispatcher != nullptr ? mDispatcher->lookup(mSlot, mGeneration) : nullptr;
+    return p != nullptr && p->done;
+}
+
+inline int HciCommandFuture::get(PacketRef* event, int to, std::chrono::nanoseconds* round_trip) {
+    if (mDispatcher == nullptr) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(to);
+    for (;;) {
+        auto p = mDispatcher->lookup(mSlot, mGeneration);
+        if (p == nullptr) {
+            // Already collected, or sending failed while flushing the queue
+            errno = EIO;
+            return -1;
+        }
+
+        if (p->done) {
+            p->used = false;
+            *event = std::move(p->event);
+            if (round_trip != nullptr) *round_trip = p->done_at - p->sent_at;
+            if (p->rejected) {
+                mRejected = true;
+                QHS_LOGW("%s: command 0x%04x rejected with status 0x%x",
+                         __func__, p->opcode, event->data()[2]);
+                errno = EIO;
+                return -1;
+            }
+            return 0;
+        }
+
+        int wait_ms = -1;
+        if (to >= 0) {
+            auto left = std::chrono::ceil<std::chrono::milliseconds>(
+                    deadline - std::chrono::steady_clock::now());
+            wait_ms = left.count() > 0 ? left.count() : 0;
+        }
+        if (mDispatcher->pump(wait_ms) < 0) {
+            // Keep the slot claimed until the late answer shows up, so it is
+            // not mistaken for the response to a newer command, but not forever
+            if (p->sent) {
+                p->abandoned = true;
+                p->reclaim_at = std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds(std::max(to, HCI_ABANDONED_MIN_MS) *
+                                                  HCI_ABANDONED_RECLAIM_FACTOR);
+            } else {
+                p->used = false;
+            }
+            return -1;
+        }
+    }
+}
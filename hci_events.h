@@ -0,0 +1,189 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <span>
+
+#include "hci_parser.h"
+#include "hci_reader.h"
+
+// Typed views of the events a host sees without asking for them, decoded
+// from the parameters after the event header. Spans point into the event.
+
+typedef struct {
+    uint8_t credits;
+    uint16_t opcode;
+    std::span<const uint8_t> return_parameters;  // status first, for most commands
+} hci_command_complete_t;
+
+typedef struct {
+    uint8_t status;
+    uint8_t credits;
+    uint16_t opcode;
+} hci_command_status_t;
+
+typedef struct {
+    uint8_t status;
+    uint16_t handle;
+    uint8_t reason;
+} hci_disconnection_complete_t;
+
+typedef struct {
+    uint8_t hardware_code;
+} hci_hardware_error_t;
+
+typedef struct {
+    uint8_t subevent_code;
+    std::span<const uint8_t> parameters;
+} hci_le_meta_event_t;
+
+// QTI parts put their own sub-event code first, others do as they like
+typedef struct {
+    std::span<const uint8_t> parameters;
+} hci_vendor_event_t;
+
+typedef struct {
+    uint8_t event_code;
+    std::span<const uint8_t> parameters;
+} hci_unknown_event_t;
+
+inline hci_result_t decode_command_complete(HciReader &params, hci_command_complete_t *evt) {
+    HCI_READ(evt->credits, params.u8());
+    HCI_READ(evt->opcode, params.u16());
+    evt->return_parameters = params.rest();
+    return {};
+}
+
+inline hci_result_t decode_command_status(HciReader &params, hci_command_status_t *evt) {
+    HCI_READ(evt->status, params.u8());
+    HCI_READ(evt->credits, params.u8());
+    HCI_READ(evt->opcode, params.u16());
+    return {};
+}
+
+inline hci_result_t decode_disconnection_complete(HciReader &params, hci_disconnection_complete_t *evt) {
+    HCI_READ(evt->status, params.u8());
+    HCI_READ(evt->handle, params.u16());
+    evt->handle &= 0x0fff;
+    HCI_READ(evt->reason, params.u8());
+    return {};
+}
+
+inline hci_result_t decode_hardware_error(HciReader &params, hci_hardware_error_t *evt) {
+    HCI_READ(evt->hardware_code, params.u8());
+    return {};
+}
+
+inline hci_result_t decode_le_meta_event(HciReader &params, hci_le_meta_event_t *evt) {
+    HCI_READ(evt->subevent_code, params.u8());
+    evt->parameters = params.rest();
+    return {};
+}
+
+inline hci_result_t decode_vendor_event(HciReader &params, hci_vendor_event_t *evt) {
+    evt->parameters = params.rest();
+    return {};
+}
+
+// Receives the events hci_dispatch_event() decoded. Handlers derive from it
+// and define the methods for the events they care about. The calls are bound
+// at compile time, so the empty defaults cost nothing.
+struct HciEventHandler {
+    void onCommandComplete(const hci_command_complete_t &) {}
+    void onCommandStatus(const hci_command_status_t &) {}
+    void onDisconnectionComplete(const hci_disconnection_complete_t &) {}
+    void onHardwareError(const hci_hardware_error_t &) {}
+    void onLeMetaEvent(const hci_le_meta_event_t &) {}
+    void onVendorEvent(const hci_vendor_event_t &) {}
+    void onUnknownEvent(const hci_unknown_event_t &) {}
+};
+
+template <typename Handler>
+using hci_event_entry_t = hci_result_t (*)(uint8_t event_code, HciReader params, Handler &handler);
+
+template <typename Handler>
+hci_result_t hci_on_command_complete(uint8_t, HciReader params, Handler &handler) {
+    hci_command_complete_t evt;
+    HCI_CHECK(decode_command_complete(params, &evt));
+    handler.onCommandComplete(evt);
+    return {};
+}
+
+template <typename Handler>
+hci_result_t hci_on_command_status(uint8_t, HciReader params, Handler &handler) {
+    hci_command_status_t evt;
+    HCI_CHECK(decode_command_status(params, &evt));
+    handler.onCommandStatus(evt);
+    return {};
+}
+
+template <typename Handler>
+hci_result_t hci_on_disconnection_complete(uint8_t, HciReader params, Handler &handler) {
+    hci_disconnection_complete_t evt;
+    HCI_CHECK(decode_disconnection_complete(params, &evt));
+    handler.onDisconnectionComplete(evt);
+    return {};
+}
+
+template <typename Handler>
+hci_result_t hci_on_hardware_error(uint8_t, HciReader params, Handler &handler) {
+    hci_hardware_error_t evt;
+    HCI_CHECK(decode_hardware_error(params, &evt));
+    handler.onHardwareError(evt);
+    return {};
+}
+
+template <typename Handler>
+hci_result_t hci_on_le_meta_event(uint8_t, HciReader params, Handler &handler) {
+    hci_le_meta_event_t evt;
+    HCI_CHECK(decode_le_meta_event(params, &evt));
+    handler.onLeMetaEvent(evt);
+    return {};
+}
+
+template <typename Handler>
+hci_result_t hci_on_vendor_event(uint8_t, HciReader params, Handler &handler) {
+    hci_vendor_event_t evt;
+    HCI_CHECK(decode_vendor_event(params, &evt));
+    handler.onVendorEvent(evt);
+    return {};
+}
+
+template <typename Handler>
+hci_result_t hci_on_unknown_event(uint8_t event_code, HciReader params, Handler &handler) {
+    handler.onUnknownEvent({event_code, params.rest()});
+    return {};
+}
+
+template <typename Handler>
+constexpr std::array<hci_event_entry_t<Handler>, 256> hci_make_event_table() {
+    std::array<hci_event_entry_t<Handler>, 256> table;
+    table.fill(hci_on_unknown_event<Handler>);
+    table[HCI_DISCONNECTION_COMPLETE_EVT] = hci_on_disconnection_complete<Handler>;
+    table[HCI_COMMAND_COMPLETE_EVT] = hci_on_command_complete<Handler>;
+    table[HCI_COMMAND_STATUS_EVT] = hci_on_command_status<Handler>;
+    table[HCI_HARDWARE_ERROR_EVT] = hci_on_hardware_error<Handler>;
+    table[HCI_LE_META_EVT] = hci_on_le_meta_event<Handler>;
+    table[HCI_VENDOR_SPECIFIC_EVT] = hci_on_vendor_event<Handler>;
+    return table;
+}
+
+// One entry per event code, built at compile time for every handler type
+template <typename Handler>
+inline constexpr std::array<hci_event_entry_t<Handler>, 256> hci_event_table =
+        hci_make_event_table<Handler>();
+
+// Decodes `event`, from the event code on, and hands it to the matching
+// method of `handler`: one bounds check of the header and one indirect call
+// through the table. Fails with the reader's error if the event is shorter
+// than it claims or than its fixed fields.
+template <typename Handler>
+hci_result_t hci_dispatch_event(std::span<const uint8_t> event, Handler &handler) {
+    if (event.size() < 2 || event.size() - 2 < event[1]) {
+        return std::unexpected(HCI_READ_SHORT);
+    }
+    return hci_event_table<Handler>[event[0]](event[0], HciReader(event.subspan(2, event[1])),
+                                              handler);
+}
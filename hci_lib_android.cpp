@@ -6,18 +6,25 @@
 #include <hwbinder/ProcessState.h>
 #include <hwbinder/IPCThreadState.h>
 
+#include "async_log.h"
 #include "hci_parser.h"
 #include "hci_lib_android.h"
+#include "hci_packet.h"
+#include "hci_trace.h"
+#include "mpsc_ring.h"
+
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
 
 
-#include <iostream>
 #include <cstdio>
-#include <queue>
+#include <cerrno>
 #include <memory>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
 
-using std::cout;
-using std::endl;
-using std::queue;
 using std::unique_ptr;
 using std::make_unique;
 
@@ -31,106 +38,174 @@ using android::hardware::hidl_vec;
 using namespace ::android::hardware::bluetooth;
 static android::sp<V1_1::IBluetoothHci> btHci_1_1;
 
-#define LOG_INFO(tag, fmt, ...) printf("INFO: %s:" fmt "\n", tag, __VA_ARGS__)
-#define LOG_ERROR(tag, fmt, ...) printf("ERROR: %s:" fmt "\n", tag, __VA_ARGS__)
+#define LOG_INFO(tag, fmt, ...) QHS_LOGI("%s:" fmt, tag, __VA_ARGS__)
+#define LOG_ERROR(tag, fmt, ...) QHS_LOGE("%s:" fmt, tag, __VA_ARGS__)
 
 #define LOG_TAG "qhs-util"
 
+#define EVENT_QUEUE_SIZE 256
+#define ACL_QUEUE_SIZE 64
+#define SCO_QUEUE_SIZE 64
+
+// Packets are pushed from HIDL binder threads and popped from the main thread.
+// Each packet type has its own lock-free ring; putEvent() bumps an eventfd so
+// a reader blocked in waitEvent() wakes up without polling. Packets that do
+// not fit are returned to the pool and counted as dropped. The rings hold raw
+// pointers; ownership moves in with put*() and back out with get*().
 class BluetoothPacketQueue {
 public:
-    BluetoothPacketQueue() : mEvents(), mAcl(), mSco() {}
+    BluetoothPacketQueue() : mEventFd(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) {}
+
+    ~BluetoothPacketQueue() {
+        if (mEventFd >= 0) close(mEventFd);
+    }
 
     bool hasEvent() {
         return !mEvents.empty();
     }
 
     BT_HDR* getEvent() {
-        if (mEvents.empty()) {
-            return nullptr;
+        return pop(mEvents);
+    }
+
+    // Blocks until an event arrives or timeout_ms elapses; a negative
+    // timeout waits forever. Returns nullptr on timeout.
+    BT_HDR* waitEvent(int timeout_ms) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        for (;;) {
+            BT_HDR* packet = pop(mEvents);
+            if (packet != nullptr) {
+                HCI_TRACE_EVENT(queue_get, packet->data + packet->offset, packet->len);
+                return packet;
+            }
+
+            int wait_ms = -1;
+            if (timeout_ms >= 0) {
+                auto left = std::chrono::ceil<std::chrono::milliseconds>(
+                        deadline - std::chrono::steady_clock::now());
+                if (left.count() <= 0) {
+                    return nullptr;
+                }
+                wait_ms = left.count();
+            }
+
+            // The eventfd counter survives a push that lands between the pop
+            // above and this poll, so no wakeup is lost.
+            struct pollfd pfd = { .fd = mEventFd, .events = POLLIN, .revents = 0 };
+            if (poll(&pfd, 1, wait_ms) > 0) {
+                uint64_t count;
+                if (read(mEventFd, &count, sizeof(count)) < 0) {
+                    // EAGAIN: another wakeup already drained the counter
+                }
+            }
         }
-        cout << "Queue empty: " << mEvents.empty() << endl;
-        auto p = mEvents.front();
-        mEvents.pop();
-        return p;
     }
 
     BT_HDR* getAcl() {
-        auto p = mAcl.front();
-        mAcl.pop();
-        return p;
+        return pop(mAcl);
     }
 
     BT_HDR* getSco() {
-        auto p = mSco.front();
-        mSco.pop();
-        return p;
+        return pop(mSco);
     }
 
     void putEvent(BT_HDR* packet) {
-        mEvents.push(packet);
+        HCI_TRACE_EVENT(queue_put, packet->data + packet->offset, packet->len);
+        if (push(mEvents, packet)) {
+            uint64_t one = 1;
+            if (write(mEventFd, &one, sizeof(one)) < 0) {
+                // Counter saturated, the reader is awake anyway
+            }
+        }
     }
 
     void putAcl(BT_HDR* packet) {
-        mAcl.push(packet);
+        push(mAcl, packet);
     }
 
     void putSco(BT_HDR* packet) {
-        mSco.push(packet);
+        push(mSco, packet);
     }
+
+    size_t eventsDropped() const { return mEvents.dropped(); }
+    size_t eventsHighWater() const { return mEvents.highWater(); }
+    size_t aclDropped() const { return mAcl.dropped(); }
+    size_t aclHighWater() const { return mAcl.highWater(); }
+    size_t scoDropped() const { return mSco.dropped(); }
+    size_t scoHighWater() const { return mSco.highWater(); }
+
 private:
-    queue<BT_HDR*> mEvents;
-    queue<BT_HDR*> mAcl;
-    queue<BT_HDR*> mSco;
+    template <size_t N>
+    static bool push(MpscRing<BT_HDR*, N>& ring, BT_HDR* packet) {
+        if (!ring.push(packet)) {
+            free_packet(packet);
+            return false;
+        }
+        return true;
+    }
+
+    template <size_t N>
+    static BT_HDR* pop(MpscRing<BT_HDR*, N>& ring) {
+        BT_HDR* packet;
+        return ring.pop(packet) ? packet : nullptr;
+    }
+
+    int mEventFd;
+    MpscRing<BT_HDR*, EVENT_QUEUE_SIZE> mEvents;
+    MpscRing<BT_HDR*, ACL_QUEUE_SIZE> mAcl;
+    MpscRing<BT_HDR*, SCO_QUEUE_SIZE> mSco;
 };
 
 static BluetoothPacketQueue pq;
 
 std::atomic<bool> initialization_complete = false;
+static std::atomic<bool> initialization_failed = false;
+static std::mutex initialization_lock;
+static std::condition_variable initialization_cond;
 
 class BluetoothHciCallbacks : public V1_1::IBluetoothHciCallbacks {
  public:
   BluetoothHciCallbacks() {
   }
 
-  BT_HDR* WrapPacketAndCopy(uint16_t event, const hidl_vec<uint8_t>& data) {
-    size_t packet_size = data.size() + BT_HDR_SIZE;
-    BT_HDR* packet = (BT_HDR *) malloc(packet_size);
-    packet->offset = 0;
-    packet->len = data.size();
-    packet->layer_specific = 0;
-    packet->event = event;
-    // TODO(eisenbach): Avoid copy here; if BT_HDR->data can be ensured to
-    // be the only way the data is accessed, a pointer could be passed here...
-    memcpy(packet->data, data.data(), data.size());
-    return packet;
+  PacketPtr WrapPacketAndCopy(uint16_t event, const hidl_vec<uint8_t>& data) {
+    // The hidl_vec is backed by the binder transaction and is gone once this
+    // callback returns, so this is the one copy; hci_read_event() hands the
+    // pooled packet to the parser in place.
+    return wrap_packet_and_copy(event, data.data(), data.size());
   }
 
   Return<void> initializationComplete(Status status) {
 
     if(status == Status::SUCCESS) {
       LOG_INFO(LOG_TAG, "%s: HCI Init OK", __func__);
+      std::lock_guard<std::mutex> lock(initialization_lock);
       initialization_complete = true;
     } else {
       LOG_ERROR(LOG_TAG, "%s: HCI Init failed ", __func__);
+      std::lock_guard<std::mutex> lock(initialization_lock);
+      initialization_failed = true;
     }
+    initialization_cond.notify_all();
     return Void();
   }
 
   Return<void> hciEventReceived(const hidl_vec<uint8_t>& event) {
+    HCI_TRACE_EVENT(hal_event, event.data(), event.size());
     auto packet = WrapPacketAndCopy(MSG_HC_TO_STACK_HCI_EVT, event);
-    pq.putEvent(packet);
+    pq.putEvent(packet.release());
     return Void();
   }
 
   Return<void> aclDataReceived(const hidl_vec<uint8_t>& data) {
     auto packet = WrapPacketAndCopy(MSG_HC_TO_STACK_HCI_ACL, data);
-    pq.putAcl(packet);
+    pq.putAcl(packet.release());
     return Void();
   }
 
   Return<void> scoDataReceived(const hidl_vec<uint8_t>& data) {
     auto packet = WrapPacketAndCopy(MSG_HC_TO_STACK_HCI_SCO, data);
-    pq.putSco(packet);
+    pq.putSco(packet.release());
     return Void();
   }
 
@@ -141,6 +216,22 @@ class BluetoothHciCallbacks : public V1_1::IBluetoothHciCallbacks {
   }
 };
 
+int hci_wait_initialization(int to) {
+    std::unique_lock<std::mutex> lock(initialization_lock);
+    auto done = [] { return initialization_complete || initialization_failed; };
+    if (to < 0) {
+        initialization_cond.wait(lock, done);
+    } else if (!initialization_cond.wait_for(lock, std::chrono::milliseconds(to), done)) {
+        errno = ETIMEDOUT;
+        return -1;
+    }
+    if (initialization_failed) {
+        errno = EIO;
+        return -1;
+    }
+    return 0;
+}
+
 int hci_devba(int dev_id, bdaddr_t *addr) {
 	memset(addr, 0, sizeof(*addr));
 	return 0;
@@ -184,33 +275,6 @@ int hci_devid(const char *name) {
 	return 42;
 }
 
-static BT_HDR* make_packet(size_t data_size) {
-  BT_HDR* ret = (BT_HDR*) malloc(sizeof(BT_HDR) + data_size);
-  assert(ret != NULL && "Buy more RAM lol");
-  ret->event = 0;
-  ret->offset = 0;
-  ret->layer_specific = 0;
-  ret->len = data_size;
-  return ret;
-}
-
-static BT_HDR* make_command(uint16_t opcode, size_t parameter_size,
-                            uint8_t** stream_out) {
-  BT_HDR* packet = make_packet(HCI_COMMAND_PREAMBLE_SIZE + parameter_size);
-
-  uint8_t* stream = packet->data;
-  UINT16_TO_STREAM(stream, opcode);
-  UINT8_TO_STREAM(stream, parameter_size);
-
-  if (stream_out != NULL) *stream_out = stream;
-
-  return packet;
-}
-
-static BT_HDR* make_command_no_params(uint16_t opcode) {
-  return make_command(opcode, 0, NULL);
-}
-
 int hci_send_cmd(int dd, uint16_t ogf, uint16_t ocf, size_t len, uint8_t *buf) {
     HciPacket data;
 
@@ -221,12 +285,13 @@ int hci_send_cmd(int dd, uint16_t ogf, uint16_t ocf, size_t len, uint8_t *buf) {
 
     uint8_t* stream_out = NULL;
 
-    auto packet = make_command((ogf << 10) | ocf, len, &stream_out);
+    PacketPtr packet = make_command((ogf << 10) | ocf, len, &stream_out);
 
     assert(stream_out != NULL && "Error in make_command");
     if (len > 0) memcpy(stream_out, buf, len);
 
-    cout << __func__ << ": OPCODE: " << ((ogf << 10) | ocf) << endl;
+    QHS_LOGD("%s: opcode 0x%04x", __func__, (ogf << 10) | ocf);
+    HCI_TRACE(cmd_send, 0, (ogf << 10) | ocf, len, 0);
 
     data.setToExternal(packet->data + packet->offset, packet->len);
 
@@ -238,42 +303,54 @@ int hci_send_cmd(int dd, uint16_t ogf, uint16_t ocf, size_t len, uint8_t *buf) {
 	return 0;
 }
 
-void hci_read_local_version(int dd, struct hci_version *ver, size_t timeout) {
-    hci_send_cmd(dd, 0x04, 0x0001, 0, NULL);
-
-    uint8_t buf[HCI_MAX_EVENT_SIZE];
-    int len = hci_read(dd, buf, HCI_MAX_EVENT_SIZE);
+int hci_read_local_version(int dd, struct hci_version *ver, int to) {
+    if (hci_send_cmd(dd, 0x04, 0x0001, 0, NULL) < 0) {
+        return -1;
+    }
 
-    printf("%s: ", __func__);
-    for (int i = 0; i < len; i++) {
-        printf("0x%02x, ", buf[i]);
+    PacketRef event;
+    int len = hci_read_event(dd, &event, to);
+    if (len < 0) {
+        return -1;
     }
-    printf("\n");
 
-    uint8_t *data = buf + 6;
+    QHS_LOGD_HEX(__func__, event.data(), len);
+
     //0x0e, 0x0c, 0x01, 0x01, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x1d, 0x00, 0x7b, 0x58,
     //LEN                    STATUS HVER  HCI_REV    LVER    MANUFAC     LSUBVER
-
-    STREAM_TO_UINT8(ver->hci_ver, data);
-    STREAM_TO_UINT16(ver->hci_rev, data);
-    STREAM_TO_UINT8(ver->lmp_ver, data);
-    STREAM_TO_UINT16(ver->manufacturer, data);
-    STREAM_TO_UINT16(ver->lmp_subver, data);
+    if (!decode_local_version(event.span(), ver)) {
+        errno = EIO;
+        return -1;
+    }
+    return 0;
 }
 
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 
-int hci_read(int dd, void *buf, size_t size) {
-    while(!pq.hasEvent()) {
-        // Waiting...
-        //cout << pq.hasEvent();
-        usleep(10);
+int hci_read_event(int dd, PacketRef *event, int to) {
+    PacketPtr packet(pq.waitEvent(to));
+    if (packet == nullptr) {
+        errno = ETIMEDOUT;
+        return -1;
     }
-    cout << "pq.hasEvent(): " << pq.hasEvent() << endl;
 
-    auto packet = pq.getEvent();
-    cout << "packet: " << packet << ", len: " << packet->len << endl;
-    memcpy(buf, packet->data, MIN(size, packet->len));
-    free(packet);
-    return MIN(size, packet->len);
+    QHS_LOGD("%s: packet %p, len %u", __func__, packet.get(), packet->len);
+    HCI_TRACE_EVENT(event_read, packet->data + packet->offset, packet->len);
+    *event = PacketRef(std::move(packet));
+    return event->size();
+}
+
+int hci_read_timeout(int dd, void *buf, size_t size, int to) {
+    PacketRef event;
+    if (hci_read_event(dd, &event, to) < 0) {
+        return -1;
+    }
+
+    size_t len = MIN(size, event.size());
+    memcpy(buf, event.data(), len);
+    return len;
+}
+
+int hci_read(int dd, void *buf, size_t size) {
+    return hci_read_timeout(dd, buf, size, -1);
 }
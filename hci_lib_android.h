@@ -1,6 +1,7 @@
 #pragma once
 
 #include "bt_compidstr.h"
+#include "hci_packet.h"
 #include <atomic>
 
 extern std::atomic<bool> initialization_complete;
@@ -39,10 +40,21 @@ struct hci_version {
 	uint8_t  lmp_ver;
 	uint16_t lmp_subver;
 };
+// Waits up to `to` milliseconds (negative waits forever) for the HAL to
+// finish initializing after hci_open_dev(). Returns -1 with errno set to
+// ETIMEDOUT, or EIO if the HAL reported a failure.
+int hci_wait_initialization(int to);
 int hci_devid(const char *name);
 int hci_devba(int dev_id, bdaddr_t *addr);
 int hci_open_dev(int dev_id);
 int hci_close_dev(int dd);
 int hci_send_cmd(int dd, uint16_t ogf, uint16_t ocf, size_t len, uint8_t *buf);
-void hci_read_local_version(int dd, struct hci_version *ver, size_t timeout);
+int hci_read_local_version(int dd, struct hci_version *ver, int to);
 int hci_read(int fd, void *buf, size_t size);
+// Like hci_read(), but gives up after `to` milliseconds (negative waits
+// forever) and returns -1 with errno set to ETIMEDOUT.
+int hci_read_timeout(int fd, void *buf, size_t size, int to);
+// Hands out the next event in place: the view shares the pooled packet the
+// HAL callback filled, so nothing is copied again on the way to the parser.
+// Returns the event length, or -1 with errno set to ETIMEDOUT.
+int hci_read_event(int fd, PacketRef *event, int to);
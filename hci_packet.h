@@ -0,0 +1,249 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include "alloc_stats.h"
+#include "hci_parser.h"
+
+// Largest packet each slot class has to hold: commands, events and SCO carry
+// at most 255 parameter bytes behind a header of up to 4 bytes, ACL is sized
+// for the 1021-byte MTU QTI controllers report.
+#define HCI_PACKET_SMALL_SIZE (4 + 255)
+#define HCI_PACKET_LARGE_SIZE (4 + 1021)
+
+#define HCI_PACKET_SMALL_COUNT 128
+#define HCI_PACKET_LARGE_COUNT 32
+
+typedef struct {
+    size_t allocs;      // packets handed out from the pool
+    size_t exhausted;   // allocations the pool could not serve
+    size_t in_use;
+    size_t peak_in_use;
+} packet_pool_stats_t;
+
+// Every packet is preceded by a reference count so a received packet can be
+// shared by PacketRef views without copying it out of its buffer.
+typedef struct {
+    std::atomic<uint32_t> refs;
+    uint32_t reserved;
+} packet_prefix_t;
+
+#define PACKET_PREFIX_SIZE (sizeof(packet_prefix_t))
+
+static_assert(PACKET_PREFIX_SIZE % alignof(BT_HDR) == 0, "BT_HDR would be misaligned");
+
+inline packet_prefix_t* packet_prefix(BT_HDR* packet) {
+    return (packet_prefix_t*) ((uint8_t*) packet - PACKET_PREFIX_SIZE);
+}
+
+// Fixed array of BT_HDR buffers with a lock-free free list, so binder
+// threads and the reader can allocate and release packets without locks or
+// calling into the allocator. The list head packs an ABA tag in the upper
+// 32 bits next to the index of the first free slot.
+template <size_t DataSize, size_t Count>
+class PacketPool {
+    static constexpr size_t kSlotSize = (PACKET_PREFIX_SIZE + BT_HDR_SIZE + DataSize + 7) & ~(size_t) 7;
+    static constexpr uint32_t kEmpty = UINT32_MAX;
+
+public:
+    PacketPool() {
+        for (size_t i = 0; i < Count; i++) {
+            mNext[i].store(i + 1 < Count ? i + 1 : kEmpty, std::memory_order_relaxed);
+        }
+        mHead.store(0, std::memory_order_relaxed);
+    }
+
+    PacketPool(const PacketPool&) = delete;
+    PacketPool& operator=(const PacketPool&) = delete;
+
+    static constexpr size_t dataSize() { return DataSize; }
+
+    // Returns nullptr when every slot is taken.
+    BT_HDR* alloc() {
+        uint64_t head = mHead.load(std::memory_order_acquire);
+        for (;;) {
+            uint32_t index = (uint32_t) head;
+            if (index == kEmpty) {
+                mExhausted.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            uint64_t next = ((head >> 32) + 1) << 32 | mNext[index].load(std::memory_order_relaxed);
+            if (mHead.compare_exchange_weak(head, next, std::memory_order_acquire)) {
+                mAllocs.fetch_add(1, std::memory_order_relaxed);
+                size_t used = mInUse.fetch_add(1, std::memory_order_relaxed) + 1;
+                size_t peak = mPeak.load(std::memory_order_relaxed);
+                while (used > peak &&
+                       !mPeak.compare_exchange_weak(peak, used, std::memory_order_relaxed)) {
+                }
+                return (BT_HDR*) (mStorage[index] + PACKET_PREFIX_SIZE);
+            }
+        }
+    }
+
+    bool owns(const BT_HDR* packet) const {
+        const uint8_t* p = (const uint8_t*) packet;
+        return p >= mStorage[0] && p < mStorage[0] + sizeof(mStorage);
+    }
+
+    void release(BT_HDR* packet) {
+        uint32_t index = ((uint8_t*) packet - mStorage[0]) / kSlotSize;
+        uint64_t head = mHead.load(std::memory_order_relaxed);
+        do {
+            mNext[index].store((uint32_t) head, std::memory_order_relaxed);
+        } while (!mHead.compare_exchange_weak(head, ((head >> 32) + 1) << 32 | index,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+        mInUse.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    packet_pool_stats_t stats() const {
+        return {
+            .allocs = mAllocs.load(std::memory_order_relaxed),
+            .exhausted = mExhausted.load(std::memory_order_relaxed),
+            .in_use = mInUse.load(std::memory_order_relaxed),
+            .peak_in_use = mPeak.load(std::memory_order_relaxed),
+        };
+    }
+
+private:
+    std::atomic<uint64_t> mHead;
+    std::atomic<size_t> mAllocs{0};
+    std::atomic<size_t> mExhausted{0};
+    std::atomic<size_t> mInUse{0};
+    std::atomic<size_t> mPeak{0};
+    std::atomic<uint32_t> mNext[Count];
+    alignas(8) uint8_t mStorage[Count][kSlotSize];
+};
+
+inline PacketPool<HCI_PACKET_SMALL_SIZE, HCI_PACKET_SMALL_COUNT> small_packet_pool;
+inline PacketPool<HCI_PACKET_LARGE_SIZE, HCI_PACKET_LARGE_COUNT> large_packet_pool;
+inline std::atomic<size_t> packet_heap_fallbacks{0};
+
+// Returns a packet to whichever pool it came from, or to the heap if
+// make_packet() had to fall back to malloc().
+inline void free_packet(BT_HDR* packet) {
+    if (packet == nullptr) {
+        return;
+    }
+    if (small_packet_pool.owns(packet)) {
+        small_packet_pool.release(packet);
+    } else if (large_packet_pool.owns(packet)) {
+        large_packet_pool.release(packet);
+    } else {
+        alloc_stats_free(packet_prefix(packet));
+    }
+}
+
+struct PacketDeleter {
+    void operator()(BT_HDR* packet) const { free_packet(packet); }
+};
+
+typedef std::unique_ptr<BT_HDR, PacketDeleter> PacketPtr;
+
+inline PacketPtr make_packet(size_t data_size) {
+    BT_HDR* ret = nullptr;
+    if (data_size <= small_packet_pool.dataSize()) {
+        ret = small_packet_pool.alloc();
+    }
+    if (ret == nullptr && data_size <= large_packet_pool.dataSize()) {
+        ret = large_packet_pool.alloc();
+    }
+    if (ret == nullptr) {
+        packet_heap_fallbacks.fetch_add(1, std::memory_order_relaxed);
+        uint8_t* mem = (uint8_t*) alloc_stats_malloc(PACKET_PREFIX_SIZE + sizeof(BT_HDR) + data_size);
+        assert(mem != NULL && "Buy more RAM lol");
+        ret = (BT_HDR*) (mem + PACKET_PREFIX_SIZE);
+    }
+    packet_prefix(ret)->refs.store(1, std::memory_order_relaxed);
+    ret->event = 0;
+    ret->offset = 0;
+    ret->layer_specific = 0;
+    ret->len = data_size;
+    return PacketPtr(ret);
+}
+
+// Shared, read-only view of a received packet. Copies bump the reference
+// count in the packet prefix instead of duplicating the payload; the buffer
+// goes back to its pool when the last view is dropped.
+class PacketRef {
+public:
+    PacketRef() : mPacket(nullptr) {}
+    explicit PacketRef(PacketPtr packet) : mPacket(packet.release()) {}
+
+    PacketRef(const PacketRef& other) : mPacket(other.mPacket) {
+        if (mPacket != nullptr) {
+            packet_prefix(mPacket)->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    PacketRef(PacketRef&& other) : mPacket(other.mPacket) {
+        other.mPacket = nullptr;
+    }
+
+    PacketRef& operator=(PacketRef other) {
+        std::swap(mPacket, other.mPacket);
+        return *this;
+    }
+
+    ~PacketRef() { reset(); }
+
+    void reset() {
+        if (mPacket != nullptr &&
+            packet_prefix(mPacket)->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            free_packet(mPacket);
+        }
+        mPacket = nullptr;
+    }
+
+    explicit operator bool() const { return mPacket != nullptr; }
+    const BT_HDR* get() const { return mPacket; }
+    // Parsers take mutable stream pointers but never write through them.
+    uint8_t* data() const { return mPacket->data + mPacket->offset; }
+    size_t size() const { return mPacket->len; }
+    std::span<const uint8_t> span() const { return {data(), size()}; }
+
+private:
+    BT_HDR* mPacket;
+};
+
+inline PacketPtr make_command(uint16_t opcode, size_t parameter_size,
+                              uint8_t** stream_out) {
+    // 2 bytes for opcode, 1 byte for parameter length (Volume 2, Part E, 5.4.1)
+    PacketPtr packet = make_packet(3 + parameter_size);
+
+    uint8_t* stream = packet->data;
+    UINT16_TO_STREAM(stream, opcode);
+    UINT8_TO_STREAM(stream, parameter_size);
+
+    if (stream_out != NULL) *stream_out = stream;
+
+    return packet;
+}
+
+inline PacketPtr wrap_packet_and_copy(uint16_t event, const uint8_t* data, size_t len) {
+    PacketPtr packet = make_packet(len);
+    packet->event = event;
+    memcpy(packet->data, data, len);
+    return packet;
+}
+
+// Combined view of both pools; `exhausted` counts packets that had to come
+// from malloc() because no pool could serve them.
+inline packet_pool_stats_t packet_pool_stats() {
+    packet_pool_stats_t small = small_packet_pool.stats();
+    packet_pool_stats_t large = large_packet_pool.stats();
+    return {
+        .allocs = small.allocs + large.allocs,
+        .exhausted = packet_heap_fallbacks.load(std::memory_order_relaxed),
+        .in_use = small.in_use + large.in_use,
+        .peak_in_use = small.peak_in_use + large.peak_in_use,
+    };
+}
@@ -2,44 +2,89 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+#ifndef __ANDROID__
+#include <bluetooth/bluetooth.h>
+#include <bluetooth/hci.h>
+#include <bluetooth/hci_lib.h>
+#else
+#include "hci_lib_android.h"
+#endif
+
+#include "async_log.h"
 #include "hci_parser.h"
+#include "hci_trace.h"
 
-static const command_opcode_t NO_OPCODE_CHECKING = 0;
+// What check_command_complete() does besides checking: recording the header
+// in the Chrome tracer and logging a failed status. Both call out, so they
+// live here, and the common path, with neither, needs no stack frame.
+__attribute__((noinline, cold)) static void trace_command_complete(command_opcode_t opcode,
+                                                                   uint8_t parameter_length,
+                                                                   uint8_t status) {
+  chrome_trace_instant("cc_header", HCI_COMMAND_COMPLETE_EVT, opcode, parameter_length, status);
+  if (status != HCI_SUCCESS) {
+    QHS_LOGW("check_command_complete: return status - 0x%x", status);
+  }
+}
 
-uint8_t* read_command_complete_header(uint8_t *stream,
-                                      command_opcode_t expected_opcode,
-                                      size_t minimum_bytes_after) {
+std::expected<size_t, hci_read_error_t> check_command_complete(std::span<const uint8_t> event,
+                                                               command_opcode_t expected_opcode,
+                                                               size_t minimum_bytes_after) {
   // Read the event header
-  uint8_t event_code;
-  uint8_t parameter_length;
-  STREAM_TO_UINT8(event_code, stream);
-  STREAM_TO_UINT8(parameter_length, stream);
+  if (event.size() < 2) {
+    return std::unexpected(HCI_READ_SHORT);
+  }
+  uint8_t event_code = event[0];
+  uint8_t parameter_length = event[1];
 
   const size_t parameter_bytes_we_read_here = 4;
 
-  // Check the event header values against what we expect
-  CHECK(event_code == HCI_COMMAND_COMPLETE_EVT);
-  CHECK(parameter_length >=
-        (parameter_bytes_we_read_here + minimum_bytes_after));
+  // Check the event header values against what we expect: all the parameters
+  // it claims have to be there, and at least the command complete header.
+  // The four fields below are then read in place.
+  if (event_code != HCI_COMMAND_COMPLETE_EVT) {
+    return std::unexpected(HCI_READ_WRONG_EVENT);
+  }
+  if (event.size() - 2 < parameter_length || parameter_length < parameter_bytes_we_read_here) {
+    return std::unexpected(HCI_READ_SHORT);
+  }
 
-  // Read the command complete header
-  command_opcode_t opcode;
-  uint8_t status;
-  STREAM_SKIP_UINT8(stream);  // skip the number of hci command packets field
-  STREAM_TO_UINT16(opcode, stream);
+  // Read the command complete header, skipping the number of hci command
+  // packets field
+  command_opcode_t opcode = event[3] | (event[4] << 8);
 
   // Check the command complete header values against what we expect
-  if (expected_opcode != NO_OPCODE_CHECKING) {
-    CHECK(opcode == expected_opcode);
+  if (expected_opcode != NO_OPCODE_CHECKING && opcode != expected_opcode) {
+    return std::unexpected(HCI_READ_WRONG_OPCODE);
   }
 
   // Assume the next field is the status field
-  STREAM_TO_UINT8(status, stream);
+  uint8_t status = event[5];
+  HCI_USDT(cc_header, event_code, opcode, parameter_length, status);
+  if (status != HCI_SUCCESS || chrome_tracer.load(std::memory_order_acquire) != nullptr) {
+    trace_command_complete(opcode, parameter_length, status);
+  }
 
   if (status != HCI_SUCCESS) {
-    fprintf(stderr, "%s: return status - 0x%x\n", __func__, status);
-    return NULL;
+    return std::unexpected(HCI_READ_FAILED);
+  }
+
+  // A failed command may return the status alone, so this comes last
+  size_t bytes_after = parameter_length - parameter_bytes_we_read_here;
+  if (bytes_after < minimum_bytes_after) {
+    return std::unexpected(HCI_READ_SHORT);
   }
 
-  return stream;
+  return bytes_after;
+}
+
+hci_result_t decode_local_version(std::span<const uint8_t> event, struct hci_version *ver) {
+  HciReader stream;
+  HCI_CHECK(read_command_complete(event, HCI_READ_LOCAL_VERSION_OPCODE, 8, &stream));
+
+  HCI_READ(ver->hci_ver, stream.u8());
+  HCI_READ(ver->hci_rev, stream.u16());
+  HCI_READ(ver->lmp_ver, stream.u8());
+  HCI_READ(ver->manufacturer, stream.u16());
+  HCI_READ(ver->lmp_subver, stream.u16());
+  return {};
 }
@@ -1,7 +1,13 @@
+#pragma once
+
 #include <stdint.h>
 #include <stdlib.h>
 #include <assert.h>
 
+#include <span>
+
+#include "hci_reader.h"
+
 typedef struct {
   uint16_t event;
   uint16_t len;
@@ -14,9 +20,40 @@ typedef struct {
 
 typedef uint16_t command_opcode_t;
 
-uint8_t* read_command_complete_header(uint8_t *stream,
-                                      command_opcode_t expected_opcode,
-                                      size_t minimum_bytes_after);
+static const command_opcode_t NO_OPCODE_CHECKING = 0;
+
+// Checks that `event`, from the event code on, completes `expected_opcode`
+// successfully and carries at least `minimum_bytes_after` bytes after the
+// status. Returns how many bytes follow the status.
+std::expected<size_t, hci_read_error_t> check_command_complete(std::span<const uint8_t> event,
+                                                               command_opcode_t expected_opcode,
+                                                               size_t minimum_bytes_after);
+
+#define HCI_COMMAND_COMPLETE_HEADER_SIZE 6
+
+// Same, and points `params` at the return parameters after the status. Only
+// the length comes back from the out-of-line check, in registers, and the
+// reader is built here, so the decoders never reload it from memory. As the
+// compiler then knows `minimum_bytes_after` are there, reads within them
+// compile to plain loads, without the reader's checks.
+inline hci_result_t read_command_complete(std::span<const uint8_t> event,
+                                          command_opcode_t expected_opcode,
+                                          size_t minimum_bytes_after, HciReader *params) {
+    auto len = check_command_complete(event, expected_opcode, minimum_bytes_after);
+    if (!len) {
+        return std::unexpected(len.error());
+    }
+    if (*len < minimum_bytes_after) {
+        __builtin_unreachable();
+    }
+    *params = HciReader({event.data() + HCI_COMMAND_COMPLETE_HEADER_SIZE, *len});
+    return {};
+}
+
+struct hci_version;
+
+// The Command Complete event of Read Local Version Information
+hci_result_t decode_local_version(std::span<const uint8_t> event, struct hci_version *ver);
 
 #define STREAM_SKIP_UINT8(p) \
   do {                       \
@@ -107,9 +144,12 @@ uint8_t* read_command_complete_header(uint8_t *stream,
     (p) += 4;                                                            \
   }
 
+#define HCI_DISCONNECTION_COMPLETE_EVT 0x05
 #define HCI_COMMAND_COMPLETE_EVT 0x0E
-
-#define CHECK(...) assert(__VA_ARGS__)
+#define HCI_COMMAND_STATUS_EVT 0x0F
+#define HCI_HARDWARE_ERROR_EVT 0x10
+#define HCI_LE_META_EVT 0x3E
+#define HCI_VENDOR_SPECIFIC_EVT 0xFF
 
 typedef enum {
     HCI_VS_QBCE_READ_LOCAL_QLM_SUPPORTED_FEATURES  = 0x09,
@@ -191,6 +231,11 @@ typedef enum {
 
 static_assert(sizeof(qbce_cmd_opcode_t) == 1, "Enum size assumtion is incorrect");
 
+#define HCI_OGF_INFORMATIONAL 0x04
+#define HCI_OCF_READ_LOCAL_VERSION 0x0001
+
+#define HCI_READ_LOCAL_VERSION_OPCODE (HCI_OCF_READ_LOCAL_VERSION | (HCI_OGF_INFORMATIONAL << 10))
+
 #define OGF_VS 0x3F
 
 #define OCF_VS_QBCE 0x0051
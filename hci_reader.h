@@ -0,0 +1,120 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <expected>
+#include <span>
+
+// One byte, so that an hci_result_t fits in a register pair with no padding
+typedef enum : uint8_t {
+    HCI_READ_SHORT,          // fewer bytes than the field or event needs
+    HCI_READ_WRONG_EVENT,    // not the event code that was expected
+    HCI_READ_WRONG_OPCODE,   // completes another command
+    HCI_READ_FAILED,         // the controller returned an error status
+} hci_read_error_t;
+
+typedef std::expected<void, hci_read_error_t> hci_result_t;
+
+inline const char *hci_read_error_str(hci_read_error_t err) {
+    switch (err) {
+    case HCI_READ_SHORT: return "event too short";
+    case HCI_READ_WRONG_EVENT: return "unexpected event";
+    case HCI_READ_WRONG_OPCODE: return "unexpected opcode";
+    case HCI_READ_FAILED: return "command failed";
+    }
+    return "unknown error";
+}
+
+// Reads fields off the front of an event. Unlike the STREAM_TO_* macros
+// every getter checks what is left first: a short read returns
+// HCI_READ_SHORT and consumes nothing, so a truncated or lying event can
+// never make the parser read past its buffer.
+class HciReader {
+public:
+    HciReader() = default;
+    explicit HciReader(std::span<const uint8_t> data) : mData(data) {}
+
+    size_t remaining() const { return mData.size(); }
+    std::span<const uint8_t> rest() const { return mData; }
+
+    std::expected<uint8_t, hci_read_error_t> u8() { return get<uint8_t, 1, false>(); }
+    std::expected<uint16_t, hci_read_error_t> u16() { return get<uint16_t, 2, false>(); }
+    std::expected<uint32_t, hci_read_error_t> u24() { return get<uint32_t, 3, false>(); }
+    std::expected<uint32_t, hci_read_error_t> u32() { return get<uint32_t, 4, false>(); }
+    std::expected<uint16_t, hci_read_error_t> be16() { return get<uint16_t, 2, true>(); }
+    std::expected<uint32_t, hci_read_error_t> be24() { return get<uint32_t, 3, true>(); }
+    std::expected<uint32_t, hci_read_error_t> be32() { return get<uint32_t, 4, true>(); }
+
+    // The next `len` bytes, in place
+    std::expected<std::span<const uint8_t>, hci_read_error_t> bytes(size_t len) {
+        if (mData.size() < len) {
+            return std::unexpected(HCI_READ_SHORT);
+        }
+        std::span<const uint8_t> out = mData.first(len);
+        mData = mData.subspan(len);
+        return out;
+    }
+
+    hci_result_t skip(size_t len) {
+        if (mData.size() < len) {
+            return std::unexpected(HCI_READ_SHORT);
+        }
+        mData = mData.subspan(len);
+        return {};
+    }
+
+    hci_result_t copy(void *dst, size_t len) {
+        if (mData.size() < len) {
+            return std::unexpected(HCI_READ_SHORT);
+        }
+        // Eight bytes at a time. Where the caller bounds the length, GCC
+        // turns a plain memcpy() or byte loop into rep movs, whose startup
+        // costs more than copying the few bytes HCI fields have.
+        const uint8_t *in = mData.data();
+        uint8_t *out = (uint8_t *) dst;
+        size_t i = 0;
+        for (; i + 8 <= len; i += 8) memcpy(out + i, in + i, 8);
+        for (; i < len; i++) out[i] = in[i];
+        mData = mData.subspan(len);
+        return {};
+    }
+
+private:
+    template <typename T, size_t N, bool BigEndian>
+    std::expected<T, hci_read_error_t> get() {
+        if (mData.size() < N) {
+            return std::unexpected(HCI_READ_SHORT);
+        }
+        uint32_t value = 0;
+        for (size_t i = 0; i < N; i++) {
+            size_t shift = BigEndian ? (N - 1 - i) * 8 : i * 8;
+            value |= (uint32_t) mData[i] << shift;
+        }
+        mData = mData.subspan(N);
+        return (T) value;
+    }
+
+    std::span<const uint8_t> mData;
+};
+
+// Like STREAM_TO_*: stores what `expr` read into `dst`, or returns its error
+// from the enclosing function, which has to return a std::expected
+#define HCI_READ(dst, expr)                              \
+    do {                                                 \
+        auto hci_read_ = (expr);                         \
+        if (!hci_read_) {                                \
+            return std::unexpected(hci_read_.error());   \
+        }                                                \
+        (dst) = *hci_read_;                              \
+    } while (0)
+
+// Same for reads that produce nothing, skip() and copy()
+#define HCI_CHECK(expr)                                  \
+    do {                                                 \
+        auto hci_read_ = (expr);                         \
+        if (!hci_read_) {                                \
+            return std::unexpected(hci_read_.error());   \
+        }                                                \
+    } while (0)
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chrome_trace.h"
+#include "hci_parser.h"
+
+// USDT probes under the "qhs" provider, for bpftrace or perf to attach to
+// without a rebuild, e.g.
+//
+//   bpftrace -e 'usdt:./qhs-util:qhs:event_read { printf("%x %d\n", arg1, arg3); }'
+//
+// Every probe carries the event code, opcode, length and status:
+//
+//   cmd_send    command about to be sent (event code and status are 0)
+//   hal_event   event handed over by the Bluetooth HAL (Android only)
+//   queue_put   event queued for the reader (Android only)
+//   queue_get   event taken off the queue by the reader (Android only)
+//   event_read  event read by the probe
+//   cc_header   Command Complete header parsed
+//
+// When <sys/sdt.h> is missing, or with -DQHS_NO_USDT, the USDT probes
+// compile to nothing. The same points are also recorded by the Chrome
+// tracer when one is installed.
+#if defined(__has_include) && !defined(QHS_NO_USDT)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define QHS_HAVE_USDT 1
+#endif
+#endif
+
+#ifdef QHS_HAVE_USDT
+#define HCI_USDT(name, evt, opcode, len, status) \
+    DTRACE_PROBE4(qhs, name, (uint8_t) (evt), (uint16_t) (opcode), (uint16_t) (len), (uint8_t) (status))
+#else
+#define HCI_USDT(name, evt, opcode, len, status) do { } while (0)
+#endif
+
+#define HCI_TRACE(name, evt, opcode, len, status)                     \
+    do {                                                              \
+        HCI_USDT(name, evt, opcode, len, status);                     \
+        chrome_trace_instant(#name, evt, opcode, len, status);        \
+    } while (0)
+
+// Opcode and status of a Command Complete or Command Status event, 0 for
+// anything else
+inline uint16_t hci_trace_opcode(const uint8_t *event, size_t len) {
+    if (len >= 5 && event[0] == HCI_COMMAND_COMPLETE_EVT) return event[3] | (event[4] << 8);
+    if (len >= 6 && event[0] == HCI_COMMAND_STATUS_EVT) return event[4] | (event[5] << 8);
+    return 0;
+}
+
+inline uint8_t hci_trace_status(const uint8_t *event, size_t len) {
+    if (len >= 6 && event[0] == HCI_COMMAND_COMPLETE_EVT) return event[5];
+    if (len >= 3 && event[0] == HCI_COMMAND_STATUS_EVT) return event[2];
+    return 0;
+}
+
+#define HCI_TRACE_EVENT(name, event, len)                                            \
+    HCI_TRACE(name, (len) > 0 ? (event)[0] : 0, hci_trace_opcode((event), (len)), (len), \
+              hci_trace_status((event), (len)))
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <errno.h>
+#include <poll.h>
+#include <stddef.h>
+#include <unistd.h>
+
+#include <chrono>
+
+#include "hci_packet.h"
+#include "hci_parser.h"
+#include "hci_trace.h"
+
+#define HCI_MAX_VENDOR_FILTER_EVENTS 16
+
+#ifndef __ANDROID__
+#include <bluetooth/bluetooth.h>
+#include <bluetooth/hci.h>
+#include <bluetooth/hci_lib.h>
+#include <linux/filter.h>
+
+#define hci_read read
+
+// libbluetooth's hci_send_cmd() has no probes of its own
+inline int hci_send_cmd_traced(int dd, uint16_t ogf, uint16_t ocf, uint8_t plen, void *param) {
+    HCI_TRACE(cmd_send, 0, (ogf << 10) | ocf, plen, 0);
+    return hci_send_cmd(dd, ogf, ocf, plen, param);
+}
+
+#define hci_send_cmd hci_send_cmd_traced
+
+// Lets only Command Complete/Status events through the kernel's HCI filter,
+// and of those only the ones for `opcode` unless it is 0. Vendor events are
+// let through as well when asked for.
+inline int hci_filter_commands(int dd, uint16_t opcode, bool vendor_events) {
+    struct hci_filter flt;
+    hci_filter_clear(&flt);
+    hci_filter_set_ptype(HCI_EVENT_PKT, &flt);
+    hci_filter_set_event(EVT_CMD_COMPLETE, &flt);
+    hci_filter_set_event(EVT_CMD_STATUS, &flt);
+    if (vendor_events) {
+        hci_filter_set_event(HCI_VENDOR_SPECIFIC_EVT, &flt);
+    }
+    hci_filter_set_opcode(opcode, &flt);
+    return setsockopt(dd, SOL_HCI, HCI_FILTER, &flt, sizeof(flt));
+}
+
+// Attaches a classic BPF program that drops vendor events unless their first
+// parameter (the sub-event code) is one of `sub_events`. Everything else the
+// HCI filter admitted passes untouched. The program sees the raw socket's
+// packet type byte first, then the event header.
+inline int hci_attach_vendor_filter(int dd, const uint8_t *sub_events, size_t count) {
+    if (count > HCI_MAX_VENDOR_FILTER_EVENTS) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    struct sock_filter code[5 + HCI_MAX_VENDOR_FILTER_EVENTS];
+    uint8_t n = 0;
+    uint8_t accept = 4 + count;
+
+    code[n] = BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 1);  // event code
+    n++;
+    code[n] = BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, HCI_VENDOR_SPECIFIC_EVT, 0, (uint8_t) (accept - n - 1));
+    n++;
+    code[n] = BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 3);  // sub-event code
+    n++;
+    for (size_t i = 0; i < count; i++, n++) {
+        code[n] = BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, sub_events[i], (uint8_t) (accept - n - 1), 0);
+    }
+    code[n++] = BPF_STMT(BPF_RET | BPF_K, 0);
+    code[n++] = BPF_STMT(BPF_RET | BPF_K, 0xffff);
+
+    struct sock_fprog prog = { .len = n, .filter = code };
+    return setsockopt(dd, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof(prog));
+}
+
+// Waits until the socket is readable or `to` milliseconds have passed
+// (negative waits forever). Returns -1 with errno set to ETIMEDOUT when the
+// controller stays silent.
+inline int hci_wait_readable(int dd, int to) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(to);
+    for (;;) {
+        int wait_ms = -1;
+        if (to >= 0) {
+            auto left = std::chrono::ceil<std::chrono::milliseconds>(
+                    deadline - std::chrono::steady_clock::now());
+            wait_ms = left.count() > 0 ? left.count() : 0;
+        }
+
+        struct pollfd pfd = { .fd = dd, .events = POLLIN, .revents = 0 };
+        int ret = poll(&pfd, 1, wait_ms);
+        if (ret > 0) {
+            return 0;
+        }
+        if (ret == 0) {
+            errno = ETIMEDOUT;
+            return -1;
+        }
+        if (errno != EINTR) {
+            return -1;
+        }
+    }
+}
+
+inline int hci_read_timeout(int dd, void *buf, size_t size, int to) {
+    if (hci_wait_readable(dd, to) < 0) {
+        return -1;
+    }
+    return read(dd, buf, size);
+}
+
+// Reads one event from the raw HCI socket straight into a pooled packet.
+// The H4 packet type byte is skipped, so the view starts at the event code
+// just like the packets the Android HAL hands us.
+inline int hci_read_event(int dd, PacketRef *event, int to) {
+    if (hci_wait_readable(dd, to) < 0) {
+        return -1;
+    }
+
+    PacketPtr packet = make_packet(HCI_PACKET_SMALL_SIZE);
+
+    ssize_t len = read(dd, packet->data, packet->len);
+    if (len < 0) {
+        return -1;
+    }
+    if (len < 1) {
+        errno = EPROTO;
+        return -1;
+    }
+
+    packet->offset = 1;
+    packet->len = len - 1;
+    HCI_TRACE_EVENT(event_read, packet->data + 1, packet->len);
+    *event = PacketRef(std::move(packet));
+    return len - 1;
+}
+#else
+#include "hci_lib_android.h"
+
+// The HAL hands over every event, there is no kernel filter to narrow
+inline int hci_filter_commands(int dd, uint16_t opcode, bool vendor_events) {
+    return 0;
+}
+
+inline int hci_attach_vendor_filter(int dd, const uint8_t *sub_events, size_t count) {
+    return 0;
+}
+#endif
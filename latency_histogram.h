@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Log-linear latency histogram in the style of HdrHistogram: every power of
+// two range is split into 64 equal buckets, so any recorded value is off by
+// less than 1/64 (1.6%) wherever it falls. Values are nanoseconds, up to
+// about 18 minutes; larger ones are clamped. Recording never allocates.
+class LatencyHistogram {
+    static constexpr unsigned kSubBucketBits = 7;
+    static constexpr uint64_t kSubBuckets = 1 << kSubBucketBits;
+    static constexpr uint64_t kHalf = kSubBuckets / 2;
+    static constexpr unsigned kMaxBits = 40;
+    static constexpr size_t kBuckets = (kMaxBits - kSubBucketBits + 2) * kHalf;
+
+public:
+    LatencyHistogram() { reset(); }
+
+    void reset() {
+        for (auto& c : mCounts) c = 0;
+        mTotal = 0;
+        mSum = 0;
+        mMin = UINT64_MAX;
+        mMax = 0;
+    }
+
+    void record(uint64_t ns) {
+        if (ns >= (1ull << kMaxBits)) ns = (1ull << kMaxBits) - 1;
+        mCounts[index(ns)]++;
+        mTotal++;
+        mSum += ns;
+        if (ns < mMin) mMin = ns;
+        if (ns > mMax) mMax = ns;
+    }
+
+    uint64_t count() const { return mTotal; }
+    uint64_t min() const { return mTotal > 0 ? mMin : 0; }
+    uint64_t max() const { return mMax; }
+    uint64_t mean() const { return mTotal > 0 ? mSum / mTotal : 0; }
+
+    // Smallest value at or below which `percentile` percent of the recorded
+    // values fall, reported as the upper end of its bucket
+    uint64_t percentile(double percentile) const {
+        if (mTotal == 0) {
+            return 0;
+        }
+        uint64_t target = (uint64_t) (percentile / 100.0 * mTotal + 0.5);
+        if (target == 0) target = 1;
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBuckets; i++) {
+            seen += mCounts[i];
+            if (seen >= target) {
+                uint64_t high = highest(i);
+                return high < mMax ? high : mMax;
+            }
+        }
+        return mMax;
+    }
+
+private:
+    static size_t index(uint64_t value) {
+        if (value < kSubBuckets) {
+            return value;
+        }
+        // Shift the value into [kHalf, kSubBuckets)
+        unsigned shift = 63 - __builtin_clzll(value) - (kSubBucketBits - 1);
+        return shift * kHalf + (value >> shift);
+    }
+
+    static uint64_t highest(size_t index) {
+        if (index < kSubBuckets) {
+            return index;
+        }
+        unsigned shift = index / kHalf - 1;
+        uint64_t sub = index - shift * kHalf;
+        return ((sub + 1) << shift) - 1;
+    }
+
+    uint64_t mCounts[kBuckets];
+    uint64_t mTotal;
+    uint64_t mSum;
+    uint64_t mMin;
+    uint64_t mMax;
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#define CACHE_LINE_SIZE 64
+
+// Bounded lock-free multi-producer/single-consumer ring.
+//
+// Each slot carries a sequence number (after D. Vyukov's bounded queue):
+// producers claim a position with a CAS on the tail and publish the slot by
+// bumping its sequence, the single consumer owns the head outright. Nothing
+// is allocated after construction; a push into a full ring fails and is
+// counted in dropped().
+template <typename T, size_t N>
+class MpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "Ring size must be a power of two");
+
+public:
+    MpscRing() {
+        for (size_t i = 0; i < N; i++) {
+            mSlots[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    // Safe to call from any number of threads concurrently.
+    bool push(T value) {
+        size_t pos = mTail.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &mSlots[pos & (N - 1)];
+            size_t seq = slot->seq.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t) seq - (intptr_t) pos;
+            if (diff == 0) {
+                if (mTail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = mTail.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Until the slot is published the consumer cannot get past it, so the
+        // head is at most `pos` here. A stale head can only overstate the
+        // depth, never beyond the ring.
+        size_t depth = pos + 1 - mHead.load(std::memory_order_relaxed);
+        if (depth > N) depth = N;
+
+        slot->value = value;
+        slot->seq.store(pos + 1, std::memory_order_release);
+
+        size_t high = mHighWater.load(std::memory_order_relaxed);
+        while (depth > high &&
+               !mHighWater.compare_exchange_weak(high, depth, std::memory_order_relaxed)) {
+        }
+        return true;
+    }
+
+    // Consumer side only.
+    bool pop(T& value) {
+        size_t pos = mHead.load(std::memory_order_relaxed);
+        Slot& slot = mSlots[pos & (N - 1)];
+        if (slot.seq.load(std::memory_order_acquire) != pos + 1) {
+            return false;
+        }
+        value = slot.value;
+        slot.seq.store(pos + N, std::memory_order_release);
+        mHead.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Consumer side only.
+    bool empty() const {
+        size_t pos = mHead.load(std::memory_order_relaxed);
+        return mSlots[pos & (N - 1)].seq.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    static constexpr size_t capacity() { return N; }
+    size_t dropped() const { return mDropped.load(std::memory_order_relaxed); }
+    size_t highWater() const { return mHighWater.load(std::memory_order_relaxed); }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Slot {
+        std::atomic<size_t> seq;
+        T value;
+    };
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> mTail{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> mHead{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> mDropped{0};
+    std::atomic<size_t> mHighWater{0};
+    Slot mSlots[N];
+};
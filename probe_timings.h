@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "alloc_stats.h"
+#include "report_writer.h"
+
+#define PROBE_MAX_STAGES 16
+
+// Monotonic start and end of each stage of one probe, relative to when the
+// probe started. Stages may overlap: pipelined commands are each timed from
+// submission to completion.
+//
+// Each stage also takes the heap counters as it ends; its allocations are
+// those made since the stage recorded before it, and its peak is the most
+// heap in use in that time above what was in use when the probe started.
+class ProbeTimings {
+public:
+    typedef std::chrono::steady_clock clock;
+
+    explicit ProbeTimings(const char *adapter) : mStart(clock::now()), mCount(0) {
+        snprintf(mAdapter, sizeof(mAdapter), "%s", adapter);
+        alloc_stats_reset_peak();
+        mHeapStart = alloc_stats();
+    }
+
+    clock::time_point started() const { return mStart; }
+
+    // `name` must outlive the timings; stages past PROBE_MAX_STAGES are lost
+    void record(const char *name, clock::time_point start, clock::time_point end = clock::now()) {
+        if (mCount == PROBE_MAX_STAGES) {
+            return;
+        }
+        alloc_stats_t heap = alloc_stats();
+        alloc_stats_reset_peak();
+        mStages[mCount++] = { name, start, end, heap };
+    }
+
+    void print(ReportWriter &out) const {
+        out.printf("%-14s %10s %10s\n", "Timings (us):", "start", "duration");
+        for (size_t i = 0; i < mCount; i++) {
+            out.printf("  %-12s %10lld %10lld\n", mStages[i].name,
+                       micros(mStart, mStages[i].start), micros(mStages[i].start, mStages[i].end));
+        }
+    }
+
+    void printAllocations(ReportWriter &out) const {
+        out.printf("%-14s %10s %10s %10s\n", "Allocations:", "count", "bytes", "peak");
+        alloc_stats_t prev = mHeapStart;
+        ptrdiff_t peak = mHeapStart.in_use;
+        for (size_t i = 0; i < mCount; i++) {
+            const alloc_stats_t &heap = mStages[i].heap;
+            peak = std::max(peak, heap.peak_in_use);
+            // A stage that spans the whole probe gets everything
+            bool whole = mStages[i].start == mStart;
+            const alloc_stats_t &from = whole ? mHeapStart : prev;
+            out.printf("  %-12s %10zu %10zu %10td\n", mStages[i].name, heap.allocs - from.allocs,
+                       heap.bytes - from.bytes,
+                       (whole ? peak : heap.peak_in_use) - mHeapStart.in_use);
+            prev = heap;
+        }
+    }
+
+    // One JSON object on a single line, written with a single call so that
+    // concurrent probes sharing `out` do not interleave
+    void dump(FILE *out) const {
+        char buf[128 + PROBE_MAX_STAGES * 96];
+        // Stages that do not fit whole are left out, so the line stays valid
+        // JSON and there is always room to close it
+        const size_t room = sizeof(buf) - sizeof("]}\n") + 1;
+        size_t len = snprintf(buf, room, "{\"adapter\":\"%s\",\"stages\":[", mAdapter);
+        for (size_t i = 0; i < mCount && len < room; i++) {
+            int n = snprintf(buf + len, room - len,
+                             "%s{\"name\":\"%s\",\"start_us\":%lld,\"duration_us\":%lld}",
+                             i > 0 ? "," : "", mStages[i].name,
+                             micros(mStart, mStages[i].start), micros(mStages[i].start, mStages[i].end));
+            if (n < 0 || (size_t) n >= room - len) {
+                buf[len] = '\0';
+                break;
+            }
+            len += n;
+        }
+        len = std::min(len, room - 1);
+        snprintf(buf + len, sizeof(buf) - len, "]}\n");
+        fputs(buf, out);
+        fflush(out);
+    }
+
+private:
+    struct Stage {
+        const char *name;
+        clock::time_point start;
+        clock::time_point end;
+        alloc_stats_t heap;
+    };
+
+    static long long micros(clock::time_point from, clock::time_point to) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+    }
+
+    char mAdapter[16];
+    clock::time_point mStart;
+    alloc_stats_t mHeapStart;
+    Stage mStages[PROBE_MAX_STAGES];
+    size_t mCount;
+};
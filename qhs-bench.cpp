@@ -0,0 +1,723 @@
+// Microbenchmarks for the parts of the probe that run on every boot: event
+// parsing, feature decoding, packet allocation and company-ID lookup.
+// --startup instead times whole runs of a command, qhs-util on either
+// backend, from exec to its first byte of output and to its exit.
+//
+// --baseline compares the results to a stored run (--json writes one) and
+// fails when a benchmark got slower than the threshold or allocates more.
+// On Linux probe_main runs qhs-util itself against the emulated controller,
+// so the whole main() flow is covered too; its allocations are the ones
+// qhs-util reports with --alloc-stats for the probe.
+//
+// Events are produced by the emulated controller, so they are byte for byte
+// what the probe sees from a QTI controller.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <thread>
+
+#include "hci_parser.cpp"
+#include "alloc_stats.h"
+#include "hci_events.h"
+#include "hci_packet.h"
+#include "qhs_features.h"
+#include "qti_emulator.h"
+#include "bt_compidstr.h"
+#include "latency_histogram.h"
+#include "mpsc_ring.h"
+
+#ifndef __ANDROID__
+#include "hci_dispatcher.h"
+#endif
+
+#define DEFAULT_MIN_TIME_MS 200
+#define DEFAULT_STARTUP_RUNS 20
+#define DEFAULT_THRESHOLD_PCT 25
+#define DEFAULT_MIN_DELTA_NS 5
+#define DEFAULT_GATE_PASSES 3
+#define DEFAULT_UTIL_PATH "./qhs-util"
+#define MAX_BENCH_RESULTS 32
+#define BENCH_ROUNDS 31
+#define BENCH_MAX_BATCH 64
+
+// Not a benchmark: a fixed amount of plain CPU work, run before the others.
+// Its time in a baseline tells how fast that machine was at the time.
+#define CALIBRATION_NAME "calibration"
+
+// Every heap allocation the benchmarked code makes is counted, the malloc()
+// fallback of make_packet() included
+QHS_COUNTING_OPERATOR_NEW
+
+// Keeps the compiler from dropping a result nothing reads
+template <typename T>
+static inline void keep(T const &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+static int min_time_ms = DEFAULT_MIN_TIME_MS;
+static const char *filter;
+
+typedef struct {
+    char name[64];
+    double ns_per_op;
+    double allocs_per_op;
+    double bytes_per_op;
+    double pool_per_op;
+} bench_result_t;
+
+static bench_result_t results[MAX_BENCH_RESULTS];
+static size_t result_count;
+
+// Heap allocations qhs-util reported for its probe in probe_main. They are
+// made in the child, out of sight of the counting operator new here, and
+// are added to the benchmark's own.
+static size_t util_allocs;
+static size_t util_bytes;
+
+// Runs `fn` (which performs `ops` operations per call) until min_time_ms has
+// passed and records time and allocations per operation. The time is the
+// median of BENCH_ROUNDS rounds, which a few preempted or lucky rounds do
+// not move; allocations are counted over all rounds. Run again, a benchmark
+// keeps its best time and its most allocations, so a pass that ran while the
+// machine was busy does not count.
+template <typename F>
+static void bench(const char *name, size_t ops, F fn, bool always = false) {
+    using clock = std::chrono::steady_clock;
+
+    if (!always && filter != NULL && strstr(name, filter) == NULL) {
+        return;
+    }
+
+    // Warm up caches and the packet pools, and size the batches between two
+    // clock reads to a sixteenth of a round, so slow operations such as
+    // whole probes still get many rounds
+    auto round_time = std::chrono::duration<double, std::nano>(
+            std::chrono::milliseconds(min_time_ms)) / BENCH_ROUNDS;
+    auto warm_start = clock::now();
+    size_t warm = 0;
+    do {
+        fn();
+        warm++;
+    } while (warm < 100 && clock::now() - warm_start < round_time);
+    std::chrono::duration<double, std::nano> per_call = (clock::now() - warm_start) / warm;
+    size_t batch = std::clamp<size_t>(round_time / per_call / 16, 1, BENCH_MAX_BATCH);
+
+    size_t iterations = 0;
+    double round_ns[BENCH_ROUNDS];
+    alloc_stats_t heap_before = alloc_stats();
+    size_t util_allocs_before = util_allocs;
+    size_t util_bytes_before = util_bytes;
+    size_t pool_before = packet_pool_stats().allocs;
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        size_t round_iterations = 0;
+        auto start = clock::now();
+        auto end = start + std::chrono::duration_cast<clock::duration>(round_time);
+        auto now = start;
+        while (now < end) {
+            for (size_t i = 0; i < batch; i++) fn();
+            round_iterations += batch;
+            now = clock::now();
+        }
+        round_ns[round] = std::chrono::duration<double, std::nano>(now - start).count() /
+                          ((double) round_iterations * ops);
+        iterations += round_iterations;
+    }
+    std::nth_element(round_ns, round_ns + BENCH_ROUNDS / 2, round_ns + BENCH_ROUNDS);
+
+    double total = (double) iterations * ops;
+    alloc_stats_t heap = alloc_stats();
+    bench_result_t r = {};
+    snprintf(r.name, sizeof(r.name), "%s", name);
+    r.ns_per_op = round_ns[BENCH_ROUNDS / 2];
+    r.allocs_per_op = (heap.allocs - heap_before.allocs + util_allocs - util_allocs_before) / total;
+    r.bytes_per_op = (heap.bytes - heap_before.bytes + util_bytes - util_bytes_before) / total;
+    r.pool_per_op = (packet_pool_stats().allocs - pool_before) / total;
+
+    for (size_t i = 0; i < result_count; i++) {
+        bench_result_t &prev = results[i];
+        if (strcmp(prev.name, name) == 0) {
+            prev.ns_per_op = std::min(prev.ns_per_op, r.ns_per_op);
+            prev.allocs_per_op = std::max(prev.allocs_per_op, r.allocs_per_op);
+            prev.bytes_per_op = std::max(prev.bytes_per_op, r.bytes_per_op);
+            prev.pool_per_op = std::max(prev.pool_per_op, r.pool_per_op);
+            return;
+        }
+    }
+    if (result_count < MAX_BENCH_RESULTS) {
+        results[result_count++] = r;
+    }
+}
+
+static void print_results() {
+    for (size_t i = 0; i < result_count; i++) {
+        const bench_result_t &r = results[i];
+        printf("%-28s %10.2f ns/op %8.3f allocs/op %8.1f B/op %8.3f pool/op\n", r.name, r.ns_per_op,
+               r.allocs_per_op, r.bytes_per_op, r.pool_per_op);
+    }
+}
+
+// One benchmark per line, which is also all load_baseline() can read back
+static int write_results(const char *path) {
+    FILE *out = fopen(path, "w");
+    if (out == NULL) {
+        return -1;
+    }
+    fprintf(out, "{\n");
+    for (size_t i = 0; i < result_count; i++) {
+        fprintf(out, "  \"%s\": {\"ns_per_op\": %.2f, \"allocs_per_op\": %.3f, \"bytes_per_op\": %.1f}%s\n",
+                results[i].name, results[i].ns_per_op, results[i].allocs_per_op,
+                results[i].bytes_per_op, i + 1 < result_count ? "," : "");
+    }
+    fprintf(out, "}\n");
+    return fclose(out);
+}
+
+static int load_baseline(const char *path, bench_result_t *baseline, size_t max) {
+    FILE *in = fopen(path, "r");
+    if (in == NULL) {
+        return -1;
+    }
+    char line[256];
+    int n = 0;
+    while (n < (int) max && fgets(line, sizeof(line), in) != NULL) {
+        bench_result_t &b = baseline[n];
+        if (sscanf(line, " \"%63[^\"]\": {\"ns_per_op\": %lf, \"allocs_per_op\": %lf, \"bytes_per_op\": %lf",
+                   b.name, &b.ns_per_op, &b.allocs_per_op, &b.bytes_per_op) == 4) {
+            n++;
+        }
+    }
+    fclose(in);
+    return n;
+}
+
+static const bench_result_t *find_result(const bench_result_t *list, size_t count,
+                                         const char *name) {
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(list[i].name, name) == 0) return &list[i];
+    }
+    return NULL;
+}
+
+// Baseline times are first scaled by how much slower or faster the
+// calibration ran here than when the baseline was taken. Time may then grow
+// by `threshold_pct` percent and by more than `min_delta_ns` to allow for
+// noise: on a few nanoseconds a percentage alone is all noise. Allocations
+// may not grow at all, they are what the watch/daemon use cannot afford.
+// Benchmarks missing from either side are skipped. Returns the number of
+// regressions.
+static int compare_baseline(const bench_result_t *baseline, int count, double threshold_pct,
+                            double min_delta_ns) {
+    double scale = 1;
+    const bench_result_t *rc = find_result(results, result_count, CALIBRATION_NAME);
+    const bench_result_t *bc = find_result(baseline, count, CALIBRATION_NAME);
+    if (rc != NULL && bc != NULL && bc->ns_per_op > 0) {
+        scale = rc->ns_per_op / bc->ns_per_op;
+        printf("%-28s %7.2fx the baseline machine's time\n", CALIBRATION_NAME, scale);
+    }
+
+    int regressions = 0;
+    for (size_t i = 0; i < result_count; i++) {
+        const bench_result_t &r = results[i];
+        if (strcmp(r.name, CALIBRATION_NAME) == 0) {
+            continue;
+        }
+        const bench_result_t *b = find_result(baseline, count, r.name);
+        if (b == NULL) {
+            printf("%-28s not in baseline\n", r.name);
+            continue;
+        }
+
+        double expected = b->ns_per_op * scale;
+        double change = expected > 0 ? (r.ns_per_op / expected - 1) * 100 : 0;
+        bool slower = change > threshold_pct && r.ns_per_op - expected > min_delta_ns;
+        bool allocates = r.allocs_per_op > b->allocs_per_op + 0.001;
+        printf("%-28s %+7.1f%% time, %.3f -> %.3f allocs/op%s\n", r.name, change,
+               b->allocs_per_op, r.allocs_per_op, slower || allocates ? "  REGRESSION" : "");
+        regressions += slower || allocates;
+    }
+    return regressions;
+}
+
+// Command Complete for a QBCE or add-on command, without the H4 byte
+static size_t emulated_event(const QtiEmulator &emu, uint16_t opcode, int sub_opcode,
+                             uint8_t *event) {
+    uint8_t cmd[5] = { H4_COMMAND_PKT, (uint8_t) opcode, (uint8_t) (opcode >> 8), 0 };
+    if (sub_opcode >= 0) {
+        cmd[3] = 1;
+        cmd[4] = sub_opcode;
+    }
+    uint8_t h4[QTI_EMU_MAX_EVENT_SIZE];
+    size_t len = emu.handleCommand(cmd, 4 + cmd[3], h4);
+    memcpy(event, h4 + 1, len - 1);
+    return len - 1;
+}
+
+// Runs `argv` once with its stdout on a pipe and records how long it took
+// from just before exec to the first byte read and to its exit. Returns the
+// exit status, or -1 if it could not be run.
+static int time_startup(char **argv, LatencyHistogram &first_byte, LatencyHistogram &finished) {
+    using clock = std::chrono::steady_clock;
+
+    int fds[2];
+    if (pipe(fds) < 0) {
+        return -1;
+    }
+
+    auto start = clock::now();
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return -1;
+    }
+    if (pid == 0) {
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+        execvp(argv[0], argv);
+        _exit(127);
+    }
+    close(fds[1]);
+
+    char buf[4096];
+    bool first = true;
+    ssize_t n;
+    while ((n = read(fds[0], buf, sizeof(buf))) != 0) {
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) break;
+        if (first) {
+            first_byte.record(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count());
+            first = false;
+        }
+    }
+    close(fds[0]);
+
+    int status;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+    }
+    finished.record(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count());
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static void print_startup(const char *name, const LatencyHistogram &h) {
+    printf("%-28s p50 %8.2f ms  p99 %8.2f ms  max %8.2f ms\n", name, h.percentile(50) / 1e6,
+           h.percentile(99) / 1e6, h.max() / 1e6);
+}
+
+static int bench_startup(char **argv, int runs) {
+    LatencyHistogram first_byte, finished;
+    int failed = 0;
+    for (int i = 0; i < runs; i++) {
+        int status = time_startup(argv, first_byte, finished);
+        if (status < 0 || status == 127) {
+            fprintf(stderr, "Can't run %s\n", argv[0]);
+            return 1;
+        }
+        failed += status != 0;
+    }
+
+    printf("%d runs of %s, %d failed\n", runs, argv[0], failed);
+    print_startup("exec to first byte", first_byte);
+    print_startup("exec to exit", finished);
+    return 0;
+}
+
+// Dependent multiplies and table loads, like the parsing and lookups being
+// measured, and nothing the compiler can fold
+static uint32_t calibration_work() {
+    static uint8_t table[256];
+    uint32_t x = 0x12345678;
+    for (int i = 0; i < 1024; i++) {
+        x = x * 1664525 + 1013904223;
+        x += table[x >> 24]++;
+    }
+    return x;
+}
+
+#ifndef __ANDROID__
+// Runs `util` on descriptor `fd` with --alloc-stats and adds the heap use it
+// reports for the whole probe to util_allocs and util_bytes. The rest of its
+// output is discarded. Returns its exit status, or -1 if it could not be run
+// or reported no allocations.
+static int run_util(const char *util, int fd) {
+    char fd_arg[32];
+    snprintf(fd_arg, sizeof(fd_arg), "--fd=%d", fd);
+    int out[2];
+    if (pipe(out) < 0) {
+        return -1;
+    }
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(out[0]);
+        close(out[1]);
+        return -1;
+    }
+    if (pid == 0) {
+        int null = open("/dev/null", O_WRONLY);
+        dup2(out[1], STDOUT_FILENO);
+        dup2(null, STDERR_FILENO);
+        execl(util, util, fd_arg, "--color=never", "--alloc-stats", (char *) NULL);
+        _exit(127);
+    }
+    close(out[1]);
+
+    // The report is a few lines, whatever does not fit is only read off
+    char report[8192];
+    size_t len = 0;
+    for (;;) {
+        char discard[512];
+        bool full = len == sizeof(report) - 1;
+        ssize_t n = full ? read(out[0], discard, sizeof(discard))
+                         : read(out[0], report + len, sizeof(report) - 1 - len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        if (!full) len += n;
+    }
+    report[len] = '\0';
+    close(out[0]);
+
+    int status;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+    }
+    if (!WIFEXITED(status)) {
+        return -1;
+    }
+
+    // The "total" row of the allocations table: count, bytes, peak
+    const char *table = strstr(report, "Allocations:");
+    const char *total = table != NULL ? strstr(table, "\n  total") : NULL;
+    size_t allocs, bytes;
+    if (total == NULL || sscanf(total, " total %zu %zu", &allocs, &bytes) != 2) {
+        return -1;
+    }
+    util_allocs += allocs;
+    util_bytes += bytes;
+    return WEXITSTATUS(status);
+}
+#endif
+
+static void usage(const char *name) {
+    printf("Usage: %s [options]\n"
+           "       %s --startup [--runs=N] -- COMMAND [ARGS...]\n"
+           "  -t, --min-time=MS  run each benchmark for at least MS (default %d)\n"
+           "  -f, --filter=STR   only run benchmarks whose name contains STR\n"
+           "  -s, --startup      time runs of COMMAND from exec to first output and exit\n"
+           "  -n, --runs=N       runs of COMMAND (default %d)\n"
+           "  -j, --json=FILE    write the results to FILE, to be used as a baseline\n"
+           "  -b, --baseline=FILE\n"
+           "                     fail if slower or allocating more than in FILE\n"
+           "  -T, --threshold=PCT\n"
+           "                     slowdown tolerated against the baseline (default %d)\n"
+           "  -D, --min-delta=NS slowdown in ns/op always tolerated (default %d)\n"
+           "  -p, --passes=N     run all benchmarks N times and keep the best of each\n"
+           "                     (default %d with --json or --baseline, else 1)\n"
+           "  -u, --util=PATH    qhs-util to run for probe_main (default %s)\n"
+           "  -h, --help         show this help\n",
+           name, name, DEFAULT_MIN_TIME_MS, DEFAULT_STARTUP_RUNS, DEFAULT_THRESHOLD_PCT,
+           DEFAULT_MIN_DELTA_NS, DEFAULT_GATE_PASSES, DEFAULT_UTIL_PATH);
+}
+
+// Every benchmark once. Returns -1 if the emulated probes failed.
+static int run_suite(const char *util_path, int pass) {
+    bench(CALIBRATION_NAME, 1, [] { keep(calibration_work()); }, true);
+
+    QtiEmulator emu(qti_emu_default_config());
+    uint8_t qll_event[QTI_EMU_MAX_EVENT_SIZE];
+    uint8_t qlmp_event[QTI_EMU_MAX_EVENT_SIZE];
+    uint8_t addon_event[QTI_EMU_MAX_EVENT_SIZE];
+    size_t qll_len = emulated_event(emu, HCI_VS_QBCE_OCF, HCI_VS_QBCE_READ_LOCAL_QLL_SUPPORTED_FEATURES, qll_event);
+    size_t qlmp_len = emulated_event(emu, HCI_VS_QBCE_OCF, HCI_VS_QBCE_READ_LOCAL_QLM_SUPPORTED_FEATURES, qlmp_event);
+    size_t addon_len = emulated_event(emu, HCI_VS_GET_ADDON_FEATURES_SUPPORT, -1, addon_event);
+
+    bench("read_command_complete", 1, [&] {
+        HciReader params;
+        keep(read_command_complete({qll_event, qll_len}, HCI_VS_QBCE_OCF,
+                                   1 + sizeof(qll_feature_set_t), &params));
+        keep(params);
+    });
+
+    bench("decode_qll_features", 1, [&] {
+        qll_feature_set_t qll = {};
+        keep(decode_qll_features({qll_event, qll_len}, &qll));
+        keep(qll);
+    });
+
+    bench("decode_qlmp_features", 1, [&] {
+        qlmp_feature_set_t qlmp = {};
+        keep(decode_qlmp_features({qlmp_event, qlmp_len}, &qlmp));
+        keep(qlmp);
+    });
+
+    bench("decode_add_on_features", 1, [&] {
+        bt_device_soc_addon_features_t soc;
+        keep(decode_add_on_features({addon_event, addon_len}, &soc));
+        keep(soc.as_struct);
+    });
+
+    // One of each event the table decodes, and one it does not know
+    static const uint8_t status_event[] = {HCI_COMMAND_STATUS_EVT, 4, 0x00, 1, 0x05, 0x04};
+    static const uint8_t disconnect_event[] = {HCI_DISCONNECTION_COMPLETE_EVT, 4, 0x00, 0x40, 0x00, 0x13};
+    static const uint8_t hw_error_event[] = {HCI_HARDWARE_ERROR_EVT, 1, 0x01};
+    static const uint8_t le_meta_event[] = {HCI_LE_META_EVT, 3, 0x14, 0x40, 0x00};
+    static const uint8_t vendor_event[] = {HCI_VENDOR_SPECIFIC_EVT, 3, 0x10, 0x01, 0x02};
+    static const uint8_t completed_event[] = {0x13, 5, 1, 0x40, 0x00, 0x01, 0x00};
+    const std::span<const uint8_t> mixed_events[] = {
+        {qll_event, qll_len}, status_event, disconnect_event, hw_error_event,
+        le_meta_event, vendor_event, completed_event,
+    };
+    struct CountingHandler : HciEventHandler {
+        unsigned count;
+        void onCommandComplete(const hci_command_complete_t &evt) { count += evt.opcode; }
+        void onCommandStatus(const hci_command_status_t &evt) { count += evt.opcode; }
+        void onDisconnectionComplete(const hci_disconnection_complete_t &evt) { count += evt.reason; }
+        void onHardwareError(const hci_hardware_error_t &evt) { count += evt.hardware_code; }
+        void onLeMetaEvent(const hci_le_meta_event_t &evt) { count += evt.subevent_code; }
+        void onVendorEvent(const hci_vendor_event_t &evt) { count += evt.parameters.size(); }
+        void onUnknownEvent(const hci_unknown_event_t &evt) { count += evt.event_code; }
+    };
+    bench("dispatch_event", sizeof(mixed_events) / sizeof(mixed_events[0]), [&] {
+        CountingHandler handler;
+        handler.count = 0;
+        for (auto &event : mixed_events) {
+            keep(hci_dispatch_event(event, handler));
+        }
+        keep(handler.count);
+    });
+
+    bench("make_command", 1, [&] {
+        uint8_t *stream;
+        PacketPtr cmd = make_command(HCI_VS_QBCE_OCF, 1, &stream);
+        UINT8_TO_STREAM(stream, HCI_VS_QBCE_READ_LOCAL_QLL_SUPPORTED_FEATURES);
+        keep(cmd.get());
+    });
+
+    // What WrapPacketAndCopy() does once the HAL callback hands over the event
+    bench("wrap_packet_and_copy", 1, [&] {
+        PacketPtr packet = wrap_packet_and_copy(0, addon_event, addon_len);
+        keep(packet.get());
+    });
+
+    // What the HAL callback and the reader do with each event on Android
+    static MpscRing<BT_HDR*, 64> queue;
+    bench("packet_queue", 1, [&] {
+        PacketPtr packet = wrap_packet_and_copy(0, qll_event, 16);
+        queue.push(packet.release());
+        BT_HDR *out;
+        if (queue.pop(out)) free_packet(out);
+    });
+
+    bench("bt_compid_name", 65536, [&] {
+        for (int id = 0; id < 65536; id++) {
+            keep(bt_compid_name(id));
+        }
+    });
+
+    // Names are taken from the table at run time so the lookups cannot be
+    // folded into constants
+    static size_t compid_next = 0;
+    bench("bt_compid_find", 64, [&] {
+        for (int i = 0; i < 64; i++) {
+            compid_next = (compid_next + 97) % BT_COMPID_COUNT;
+            keep(bt_compid_find(bt_compid_name(bt_compid_index[compid_next])));
+        }
+    });
+
+#ifndef __ANDROID__
+    // The whole exchange of a probe: version and the three vendor queries
+    // through the dispatcher and raw socket transport, answered by the
+    // emulator on another thread
+    int sv[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sv) < 0) {
+        perror("socketpair");
+        return -1;
+    }
+    std::atomic<bool> stop{false};
+    std::thread controller([&] { qti_emu_serve(sv[1], emu, stop); });
+    int probe_failures = 0;
+
+    bench("probe_emulated", 1, [&] {
+        HciDispatcher hci(sv[0]);
+        uint8_t qll_cmd = HCI_VS_QBCE_READ_LOCAL_QLL_SUPPORTED_FEATURES;
+        uint8_t qlmp_cmd = HCI_VS_QBCE_READ_LOCAL_QLM_SUPPORTED_FEATURES;
+        HciCommandFuture replies[] = {
+            hci.submit(HCI_OGF_INFORMATIONAL, HCI_OCF_READ_LOCAL_VERSION, 0, NULL),
+            hci.submit(OGF_VS, OCF_VS_ADDON, 0, NULL),
+            hci.submit(OGF_VS, OCF_VS_QBCE, 1, &qll_cmd, qll_cmd),
+            hci.submit(OGF_VS, OCF_VS_QBCE, 1, &qlmp_cmd, qlmp_cmd),
+        };
+        PacketRef events[4];
+        for (int i = 0; i < 4; i++) {
+            if (!replies[i].valid() || replies[i].get(&events[i], 1000) < 0) {
+                probe_failures++;
+                return;
+            }
+        }
+        struct hci_version ver;
+        keep(decode_local_version(events[0].span(), &ver));
+        bt_device_soc_addon_features_t soc;
+        qll_feature_set_t qll = {};
+        qlmp_feature_set_t qlmp = {};
+        keep(decode_add_on_features(events[1].span(), &soc));
+        keep(decode_qll_features(events[2].span(), &qll));
+        keep(decode_qlmp_features(events[3].span(), &qlmp));
+    });
+
+    // All of qhs-util, from exec through probe_controller() and the report
+    // to its exit, on a socket pair of its own that it inherits
+    int util_sv[2];
+    int util_failures = 0;
+    if (access(util_path, X_OK) < 0) {
+        if (pass == 0 && (filter == NULL || strstr("probe_main", filter) != NULL)) {
+            printf("%-28s skipped, %s: %s\n", "probe_main", util_path, strerror(errno));
+        }
+    } else if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, util_sv) < 0) {
+        perror("socketpair");
+        return -1;
+    } else {
+        fcntl(util_sv[1], F_SETFD, FD_CLOEXEC);
+        std::thread util_controller([&] { qti_emu_serve(util_sv[1], emu, stop); });
+        bench("probe_main", 1, [&] {
+            util_failures += run_util(util_path, util_sv[0]) != 0;
+        });
+        stop.store(true, std::memory_order_relaxed);
+        util_controller.join();
+        close(util_sv[0]);
+        close(util_sv[1]);
+    }
+
+    stop.store(true, std::memory_order_relaxed);
+    controller.join();
+    close(sv[0]);
+    close(sv[1]);
+    if (probe_failures > 0) {
+        fprintf(stderr, "probe_emulated: %d probes failed\n", probe_failures);
+        return -1;
+    }
+    if (util_failures > 0) {
+        fprintf(stderr, "probe_main: %d runs of %s failed\n", util_failures, util_path);
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    static const struct option options[] = {
+        { "min-time", required_argument, NULL, 't' },
+        { "filter",   required_argument, NULL, 'f' },
+        { "startup",  no_argument,       NULL, 's' },
+        { "runs",     required_argument, NULL, 'n' },
+        { "json",     required_argument, NULL, 'j' },
+        { "baseline", required_argument, NULL, 'b' },
+        { "threshold", required_argument, NULL, 'T' },
+        { "min-delta", required_argument, NULL, 'D' },
+        { "util",     required_argument, NULL, 'u' },
+        { "passes",   required_argument, NULL, 'p' },
+        { "help",     no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+    bool startup = false;
+    int runs = DEFAULT_STARTUP_RUNS;
+    const char *json_path = NULL;
+    const char *baseline_path = NULL;
+    double threshold_pct = DEFAULT_THRESHOLD_PCT;
+    double min_delta_ns = DEFAULT_MIN_DELTA_NS;
+    const char *util_path = DEFAULT_UTIL_PATH;
+    int passes = 0;
+    int opt;
+
+    while ((opt = getopt_long(argc, argv, "t:f:sn:j:b:T:D:u:p:h", options, NULL)) != -1) {
+        switch (opt) {
+        case 't':
+            min_time_ms = atoi(optarg);
+            break;
+        case 'f':
+            filter = optarg;
+            break;
+        case 's':
+            startup = true;
+            break;
+        case 'n':
+            runs = atoi(optarg);
+            break;
+        case 'j':
+            json_path = optarg;
+            break;
+        case 'b':
+            baseline_path = optarg;
+            break;
+        case 'T':
+            threshold_pct = atof(optarg);
+            break;
+        case 'D':
+            min_delta_ns = atof(optarg);
+            break;
+        case 'u':
+            util_path = optarg;
+            break;
+        case 'p':
+            passes = std::max(atoi(optarg), 1);
+            break;
+        case 'h':
+            usage(argv[0]);
+            return 0;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (startup) {
+        if (optind == argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        return bench_startup(argv + optind, runs);
+    }
+
+    alloc_stats_enabled.store(true, std::memory_order_relaxed);
+
+    // The machine's speed drifts over seconds, runs meant for comparison
+    // take their best of a few passes spread over that time
+    if (passes == 0) {
+        passes = json_path != NULL || baseline_path != NULL ? DEFAULT_GATE_PASSES : 1;
+    }
+    for (int pass = 0; pass < passes; pass++) {
+        if (run_suite(util_path, pass) < 0) {
+            return 1;
+        }
+    }
+    print_results();
+
+    if (json_path != NULL && write_results(json_path) < 0) {
+        perror("Can't write results");
+        return 1;
+    }
+    if (baseline_path != NULL) {
+        bench_result_t baseline[MAX_BENCH_RESULTS];
+        int count = load_baseline(baseline_path, baseline, MAX_BENCH_RESULTS);
+        if (count < 0) {
+            perror("Can't read baseline");
+            return 1;
+        }
+        printf("\nAgainst %s:\n", baseline_path);
+        int regressions = compare_baseline(baseline, count, threshold_pct, min_delta_ns);
+        if (regressions > 0) {
+            printf("%d regression%s\n", regressions, regressions > 1 ? "s" : "");
+            return 1;
+        }
+    }
+    return 0;
+}
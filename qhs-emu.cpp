@@ -0,0 +1,194 @@
+// Emulated QTI controller for testing qhs-util without hardware.
+//
+// Registers a virtual controller through /dev/vhci (or serves an inherited
+// SOCK_SEQPACKET descriptor with --fd) and answers the commands qhs-util
+// sends with the configured feature bitmaps, latency and errors.
+
+#include <fcntl.h>
+#include <getopt.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <atomic>
+
+#include "qti_emulator.h"
+
+#define VHCI_DEVICE "/dev/vhci"
+
+// vhci expects a vendor packet with the device type before anything else
+#define HCI_VENDOR_PKT 0xff
+#define HCI_PRIMARY 0x00
+
+static std::atomic<bool> stop_requested;
+
+static void on_signal(int) {
+    stop_requested.store(true, std::memory_order_relaxed);
+}
+
+// Parses a feature bitmap given as hex bytes in wire order, e.g. 1f7f7f13.
+// Bytes left out are cleared.
+static int parse_bitmap(const char *hex, uint8_t *bitmap, size_t size) {
+    size_t len = strlen(hex);
+    if (len % 2 != 0 || len / 2 > size) {
+        return -1;
+    }
+    memset(bitmap, 0, size);
+    for (size_t i = 0; i < len / 2; i++) {
+        char byte[3] = { hex[2 * i], hex[2 * i + 1], '\0' };
+        char *end;
+        bitmap[i] = strtoul(byte, &end, 16);
+        if (*end != '\0') {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// OPCODE[/SUB]=STATUS, e.g. 0xfc51/0x0b=0x01 to fail the local QLL read
+static int parse_error(const char *arg, qti_emu_config_t *config) {
+    if (config->error_count == QTI_EMU_MAX_ERRORS) {
+        return -1;
+    }
+    qti_emu_error_t *e = &config->errors[config->error_count];
+    char *end;
+
+    e->opcode = strtoul(arg, &end, 0);
+    e->sub_opcode = QTI_EMU_ANY_SUB_OPCODE;
+    if (*end == '/') {
+        e->sub_opcode = strtoul(end + 1, &end, 0);
+    }
+    if (*end != '=') {
+        return -1;
+    }
+    e->status = strtoul(end + 1, &end, 0);
+    if (*end != '\0' || e->status == HCI_SUCCESS) {
+        return -1;
+    }
+    config->error_count++;
+    return 0;
+}
+
+static int open_vhci() {
+    int fd = open(VHCI_DEVICE, O_RDWR);
+    if (fd < 0) {
+        perror("Can't open " VHCI_DEVICE);
+        return -1;
+    }
+
+    uint8_t create[] = { HCI_VENDOR_PKT, HCI_PRIMARY };
+    if (write(fd, create, sizeof(create)) != sizeof(create)) {
+        perror("Can't create virtual controller");
+        close(fd);
+        return -1;
+    }
+
+    // Vendor packet, opcode and the index of the new adapter
+    uint8_t reply[4];
+    if (read(fd, reply, sizeof(reply)) != sizeof(reply) || reply[0] != HCI_VENDOR_PKT) {
+        fprintf(stderr, "Unexpected reply from " VHCI_DEVICE "\n");
+        close(fd);
+        return -1;
+    }
+    printf("Emulating a QTI controller as hci%d\n", reply[2] | (reply[3] << 8));
+    fflush(stdout);
+    return fd;
+}
+
+static void usage(const char *name) {
+    printf("Usage: %s [options]\n"
+           "  -l, --latency=US         answer each command after US microseconds (default 0)\n"
+           "  -c, --credits=N          command credits to report (default 1)\n"
+           "  -m, --manufacturer=ID    company ID in Read Local Version (default 0x001d)\n"
+           "  -s, --lmp-subver=N       LMP subversion (default 0x587b)\n"
+           "  -A, --addon=HEX          add-on feature bitmap\n"
+           "  -L, --qll=HEX            QLL feature bitmap\n"
+           "  -Q, --qlmp=HEX           QLMP feature bitmap\n"
+           "  -E, --error=OP[/SUB]=ST  fail command OP (QBCE sub-opcode SUB) with status ST\n"
+           "  -f, --fd=N               serve descriptor N instead of " VHCI_DEVICE "\n"
+           "  -h, --help               show this help\n",
+           name);
+}
+
+int main(int argc, char **argv) {
+    static const struct option options[] = {
+        { "latency",      required_argument, NULL, 'l' },
+        { "credits",      required_argument, NULL, 'c' },
+        { "manufacturer", required_argument, NULL, 'm' },
+        { "lmp-subver",   required_argument, NULL, 's' },
+        { "addon",        required_argument, NULL, 'A' },
+        { "qll",          required_argument, NULL, 'L' },
+        { "qlmp",         required_argument, NULL, 'Q' },
+        { "error",        required_argument, NULL, 'E' },
+        { "fd",           required_argument, NULL, 'f' },
+        { "help",         no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+    qti_emu_config_t config = qti_emu_default_config();
+    int fd = -1;
+    int opt;
+
+    while ((opt = getopt_long(argc, argv, "l:c:m:s:A:L:Q:E:f:h", options, NULL)) != -1) {
+        switch (opt) {
+        case 'l':
+            config.latency_us = strtoul(optarg, NULL, 0);
+            break;
+        case 'c':
+            config.credits = strtoul(optarg, NULL, 0);
+            break;
+        case 'm':
+            config.manufacturer = strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            config.lmp_subver = strtoul(optarg, NULL, 0);
+            break;
+        case 'A':
+        case 'L':
+        case 'Q': {
+            int ret = opt == 'A' ? parse_bitmap(optarg, config.addon_features, sizeof(config.addon_features))
+                    : opt == 'L' ? parse_bitmap(optarg, config.qll_features, sizeof(config.qll_features))
+                    : parse_bitmap(optarg, config.qlmp_features, sizeof(config.qlmp_features));
+            if (ret < 0) {
+                fprintf(stderr, "Invalid feature bitmap: %s\n", optarg);
+                return 1;
+            }
+            break;
+        }
+        case 'E':
+            if (parse_error(optarg, &config) < 0) {
+                fprintf(stderr, "Invalid error override: %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 'f':
+            fd = atoi(optarg);
+            break;
+        case 'h':
+            usage(argv[0]);
+            return 0;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (fd < 0 && (fd = open_vhci()) < 0) {
+        return 1;
+    }
+
+    struct sigaction sa = {};
+    sa.sa_handler = on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    QtiEmulator emu(config);
+    int ret = qti_emu_serve(fd, emu, stop_requested);
+    if (ret < 0) {
+        perror("Emulator I/O failed");
+    }
+    // Closing /dev/vhci unregisters the controller
+    close(fd);
+    return ret < 0 ? 1 : 0;
+}
@@ -4,33 +4,52 @@
 #include <string.h>
 #include <assert.h>
 #include <stdbool.h>
+#include <getopt.h>
 
-#include "hci_parser.cpp"
-
-#ifndef __ANDROID__
-#include <bluetooth/bluetooth.h>
-#include <bluetooth/hci.h>
-#include <bluetooth/hci_lib.h>
-
-#define hci_read read
-#else
-#include "hci_lib_android.h"
+#ifdef __ANDROID__
+#include <sys/system_properties.h>
 #endif
 
-#define DEBUG
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "hci_parser.cpp"
+#include "async_log.h"
+#include "hci_transport.h"
+#include "hci_dispatcher.h"
+#include "hci_events.h"
+#include "qhs_features.h"
+#include "probe_timings.h"
+#include "latency_histogram.h"
+#include "report_writer.h"
+#include "alloc_stats.h"
+#include "version_cache.h"
+#include "bt_compidstr.h"
 
 #define ARRAY_SIZE(x) sizeof(x) / sizeof((x)[0])
 #define BOOL(x) (x) ? "T" : "F"
+#define BOOL_Fmt(x) "\033[%dm" x "\033[39m"
+#define BOOL_Arg(x) (x) ? 32 : 31
+
+#define DEFAULT_COMMAND_TIMEOUT_MS 1000
+#define DEFAULT_PROBE_BUDGET_MS 10000
+#define DEFAULT_STRESS_COUNT 1000
 
 #define BDADDR_Fmt "%02X:%02X:%02X:%02X:%02X:%02X"
 #define BDADDR_Arg(a) (a).b[5], (a).b[4], (a).b[3], (a).b[2], (a).b[1], (a).b[0]
 
-void hexdump(const char *start, uint8_t *buf, size_t len) {
-    printf("%s0x%02x", start, buf[0]);
-    for(size_t i = 1; i < len; i++) {
-        printf(", 0x%02x", buf[i]);
-    }
-    printf("\n");
+QHS_COUNTING_OPERATOR_NEW
+
+// Where a probe reports to. Reports are collected in memory and written out
+// in one go when the probe is done; each adapter probed by --all gets its
+// own, so concurrent probes do not interleave.
+static thread_local ReportWriter *probe_out;
+static thread_local ReportWriter *probe_err;
+static bool report_colour;
+
+static void probe_perror(const char *s) {
+    probe_err->printf("%s: %s\n", s, strerror(errno));
 }
 
 typedef struct {
@@ -43,326 +62,156 @@ typedef struct {
 } vendor_info_t;
 
 
-vendor_info_t versions[] = {
-    {0x001D, 9, 2000},
-    {0x000A, 9, 3000},
-};
-
-typedef struct {
-    uint8_t split_acl : 1;
-    uint8_t tws_esco : 1;
-    uint8_t esco_dtx : 1;
-    uint8_t high_level_ch_msg : 1;
-    uint8_t bredr_qhs_p2 : 1;
-    uint8_t qhs_p3 : 1;
-    uint8_t qhs_p4 : 1;
-    uint8_t qhs_p5 : 1;
-
-    uint8_t qhs_p6 : 1;
-    uint8_t rtp_burst : 1;
-    uint8_t frozen_clk : 1;
-    uint8_t rt_soft_comb : 1;
-    uint8_t nonce : 1;
-    uint8_t reserved1 : 3;
-
-    uint8_t reserved2[14];
-}  __attribute__ ((__packed__)) qlmp_feature_set_t;
-
-#define BOOL_Fmt(x) "\033[%dm" x "\033[39m"
-#define BOOL_Arg(x) (x) ? 32 : 31
-
-#define QLMP_FEATURE_SET_Fmt "QHS: [" BOOL_Fmt("2M/BR/EDR") ", " BOOL_Fmt("3M") ", " BOOL_Fmt("4M") ", " BOOL_Fmt("5M") ", " BOOL_Fmt("6M") "], " BOOL_Fmt("Higher Layer Channel Messages") ",\n    " \
-                             BOOL_Fmt("eSCO DTX") ", " BOOL_Fmt("TWS eSCO") ", " BOOL_Fmt("Split ACL") ",\n    " \
-                             BOOL_Fmt(" BR/EDR Packet Emulation Mode separate ACL and eSCO nonce support") ",\n    " \
-                             BOOL_Fmt("Real Time Soft Combining") ", " BOOL_Fmt("Frozen CLK eSCO Nonce Format") ",\n    " \
-                             BOOL_Fmt("Round Trip Phase measurement burst support")
-
-#define QLMP_FEATURE_SET_Arg(x) BOOL_Arg((x).bredr_qhs_p2), BOOL_Arg((x).qhs_p3), BOOL_Arg((x).qhs_p4), BOOL_Arg((x).qhs_p5), BOOL_Arg((x).qhs_p6), \
-                                BOOL_Arg((x).high_level_ch_msg), BOOL_Arg((x).esco_dtx), BOOL_Arg((x).tws_esco), BOOL_Arg((x).split_acl), \
-                                BOOL_Arg((x).nonce), BOOL_Arg((x).rt_soft_comb), BOOL_Arg((x).frozen_clk), BOOL_Arg((x).rtp_burst)
+// SIG company IDs never change, their display names do
+#define BT_COMPID_QUALCOMM 0x001D                 // Qualcomm
+#define BT_COMPID_CAMBRIDGE_SILICON_RADIO 0x000A  // Cambridge Silicon Radio
 
+constexpr vendor_info_t versions[] = {
+    {BT_COMPID_QUALCOMM, 9, 2000},
+    {BT_COMPID_CAMBRIDGE_SILICON_RADIO, 9, 3000},
+};
 
-typedef struct {
-    uint8_t status;
-    qbce_cmd_opcode_t opcode;
-    union {
-        qlmp_feature_set_t qlmp;
-    };
-} __attribute__ ((packed)) qbce_event_t;
+HciCommandFuture hci_request_local_qlmp_features(HciDispatcher &hci) {
+    uint8_t cmd = HCI_VS_QBCE_READ_LOCAL_QLM_SUPPORTED_FEATURES;
+    return hci.submit(OGF_VS, OCF_VS_QBCE, 1, &cmd, cmd);
+}
 
-int hci_read_local_qlmp_features(int dd, qlmp_feature_set_t *qlmp, int to) {
-    uint8_t buf[HCI_MAX_EVENT_SIZE] = {HCI_VS_QBCE_READ_LOCAL_QLM_SUPPORTED_FEATURES};
-    if (hci_send_cmd(dd, OGF_VS, OCF_VS_QBCE, 1, buf) < 0) {
-        perror("Error reading local QLMP features");
+int hci_read_local_qlmp_features(HciCommandFuture &reply, qlmp_feature_set_t *qlmp, int to) {
+    if (!reply.valid()) {
+        probe_perror("Error reading local QLMP features");
         return -1;
     }
 
-    ssize_t len = 0;
-    if ((len = hci_read(dd, buf, sizeof(buf))) < 0) {
-        perror("Read failed");
+    PacketRef event;
+    if (reply.get(&event, to) < 0) {
+        probe_perror("Read failed");
         return -1;
     }
-
-#ifdef DEBUG
-
-    printf("HCI QLMP Features (len %zd)", len);
-    hexdump(": ", buf, len);
-
-#endif
-#ifndef __ANDROID__
-    uint8_t* stream = read_command_complete_header(&buf[1], HCI_VS_QBCE_OCF, sizeof(*qlmp));
-#else
-    uint8_t* stream = read_command_complete_header(&buf[0], HCI_VS_QBCE_OCF, sizeof(*qlmp));
-#endif
-
-    if (stream) {
-        uint8_t sub_opcode;
-        STREAM_TO_UINT8(sub_opcode, stream);
-        if (sub_opcode == HCI_VS_QBCE_READ_LOCAL_QLM_SUPPORTED_FEATURES) {
-            uint8_t *arr = (uint8_t *) qlmp;
-            STREAM_TO_ARRAY(arr, stream, (int) sizeof(*qlmp));
-        }
-    } else {
-        fprintf(stderr, "%s: stream null check cmnd status reason", __func__);
+    QHS_LOGD_HEX("HCI QLMP Features", event.data(), event.size());
+    ChromeTraceSpan span("decode_qlmp", HCI_VS_QBCE_OCF);
+    if (auto res = decode_qlmp_features(event.span(), qlmp); !res) {
+        probe_err->printf("%s: %s\n", __func__, hci_read_error_str(res.error()));
         return -1;
     }
     return 0;
 }
 
-typedef struct {
-    uint8_t qll_hs_p2_tx : 1;
-    uint8_t qll_hs_p3_tx : 1;
-    uint8_t qll_hs_p4_tx : 1;
-    uint8_t qll_hs_p5_tx : 1;
-    uint8_t qll_hs_p6_tx : 1;
-    uint8_t qll_hs_p2_rx : 1;
-    uint8_t qll_hs_p3_rx : 1;
-    uint8_t qll_hs_p4_rx : 1;
-
-    uint8_t qll_hs_p5_rx : 1;
-    uint8_t qll_hs_p6_rx : 1;
-    uint8_t qll_hs_f2_tx : 1;
-    uint8_t qll_hs_f3_tx : 1;
-    uint8_t qll_hs_f4_tx : 1;
-    uint8_t qll_hs_f5_tx : 1;
-    uint8_t qll_hs_f6_tx : 1;
-    uint8_t qll_hs_f2_rx : 1;
-
-    uint8_t qll_hs_f3_rx  : 1;
-    uint8_t qll_hs_f4_rx  : 1;
-    uint8_t qll_hs_f5_rx  : 1;
-    uint8_t qll_hs_f6_rx  : 1;
-    uint8_t rtsc          : 1;
-    uint8_t reserved1     : 1;
-    uint8_t qll_ext_iso   : 1;
-    uint8_t qll_ext_isoal : 1;
-
-    uint8_t qll_le_edph          : 1;
-    uint8_t reserved3           : 1;
-    uint8_t qll_ft_change       : 1;
-    uint8_t qll_bn_var_qhs_rate : 1;
-    uint8_t reserved2           : 4;
-
-    uint8_t reserved4[3];
-
-    uint8_t reserved6 : 5;
-    uint8_t qll_xpan  : 1;
-    uint8_t reserved5 : 2;
-}  __attribute__ ((__packed__)) qll_feature_set_t;
-
-#define QLL_FEATURE_SET_Fmt BOOL_Fmt("HS PSK 2M TX") ", " BOOL_Fmt("HS PSK 3M TX") ", " BOOL_Fmt("HS PSK 4M TX") ", " BOOL_Fmt("HS PSK 5M TX") ", " BOOL_Fmt("HS PSK 6M TX") ", " BOOL_Fmt("HS PSK 2M RX") ", " BOOL_Fmt("HS PSK 3M RX") ", " BOOL_Fmt("HS PSK 4M RX") ", \n    " \
-                             BOOL_Fmt("HS PSK 5M RX") ", " BOOL_Fmt("HS PSK 6M RX") ", " BOOL_Fmt("HS FSK 2M TX") ", " BOOL_Fmt("HS FSK 3M TX") ", " BOOL_Fmt("HS FSK 4M TX") ", " BOOL_Fmt("HS FSK 5M TX") ", " BOOL_Fmt("HS FSK 6M TX") ", " BOOL_Fmt("HS FSK 2M RX") ", \n    " \
-                             BOOL_Fmt("HS FSK 3M RX") ", " BOOL_Fmt("HS FSK 4M RX") ", " BOOL_Fmt("HS FSK 5M RX") ", " BOOL_Fmt("HS FSK 6M RX") ", " BOOL_Fmt("RTSC") ", " BOOL_Fmt("Extended ISO") ", " BOOL_Fmt("Extended ISOAL") ", \n    " \
-                             BOOL_Fmt(" BN Variation by QHS Rate") ", " BOOL_Fmt("FT Change") ", " BOOL_Fmt("LE EDPH") ", " BOOL_Fmt("XPAN support in host")
-
-#define QLL_FEATURE_SET_Arg(x) BOOL_Arg((x).qll_hs_p2_tx), BOOL_Arg((x).qll_hs_p3_tx), BOOL_Arg((x).qll_hs_p4_tx), BOOL_Arg((x).qll_hs_p5_tx), BOOL_Arg((x).qll_hs_p6_tx), BOOL_Arg((x).qll_hs_p2_rx), BOOL_Arg((x).qll_hs_p3_rx), BOOL_Arg((x).qll_hs_p4_rx), \
-                               BOOL_Arg((x).qll_hs_p5_rx), BOOL_Arg((x).qll_hs_p6_rx), BOOL_Arg((x).qll_hs_f2_tx), BOOL_Arg((x).qll_hs_f3_tx), BOOL_Arg((x).qll_hs_f4_tx), BOOL_Arg((x).qll_hs_f5_rx), BOOL_Arg((x).qll_hs_f6_tx), BOOL_Arg((x).qll_hs_f2_rx), \
-                               BOOL_Arg((x).qll_hs_f3_rx), BOOL_Arg((x).qll_hs_f4_rx), BOOL_Arg((x).qll_hs_f5_rx), BOOL_Arg((x).qll_hs_f6_rx), BOOL_Arg((x).rtsc), BOOL_Arg((x).qll_ext_iso), BOOL_Arg((x).qll_ext_isoal), \
-                               BOOL_Arg((x).qll_bn_var_qhs_rate), BOOL_Arg((x).qll_ft_change), BOOL_Arg((x).qll_le_edph), BOOL_Arg((x).qll_xpan)
-
-
-int hci_read_local_qll_features(int dd, qll_feature_set_t *qll, int to) {
-    uint8_t buf[HCI_MAX_EVENT_SIZE] = {HCI_VS_QBCE_READ_LOCAL_QLL_SUPPORTED_FEATURES};
-    if (hci_send_cmd(dd, OGF_VS, OCF_VS_QBCE, 1, buf) < 0) {
-        perror("Error reading local QLMP features");
+HciCommandFuture hci_request_local_qll_features(HciDispatcher &hci) {
+    uint8_t cmd = HCI_VS_QBCE_READ_LOCAL_QLL_SUPPORTED_FEATURES;
+    return hci.submit(OGF_VS, OCF_VS_QBCE, 1, &cmd, cmd);
+}
+
+int hci_read_local_qll_features(HciCommandFuture &reply, qll_feature_set_t *qll, int to) {
+    if (!reply.valid()) {
+        probe_perror("Error reading local QLL features");
         return -1;
     }
 
-    ssize_t len = 0;
-    if ((len = hci_read(dd, buf, sizeof(buf))) < 0) {
-        perror("Read failed");
+    PacketRef event;
+    if (reply.get(&event, to) < 0) {
+        probe_perror("Read failed");
         return -1;
     }
+    QHS_LOGD_HEX("HCI QLL Features", event.data(), event.size());
+    ChromeTraceSpan span("decode_qll", HCI_VS_QBCE_OCF);
+    if (auto res = decode_qll_features(event.span(), qll); !res) {
+        probe_err->printf("%s: %s\n", __func__, hci_read_error_str(res.error()));
+        return -1;
+    }
+    return 0;
+}
 
-#ifdef DEBUG
-
-    printf("HCI QLL Features (len %zd)", len);
-    hexdump(": ", buf, len);
+HciCommandFuture hci_request_add_on_features(HciDispatcher &hci) {
+    return hci.submit(OGF_VS, OCF_VS_ADDON, 0, NULL);
+}
 
-#endif
-#ifndef __ANDROID__
-    uint8_t *stream = read_command_complete_header(&buf[1], HCI_VS_QBCE_OCF, sizeof(*qll));
-#else
-    uint8_t *stream = read_command_complete_header(&buf[0], HCI_VS_QBCE_OCF, sizeof(*qll));
-#endif
+int hci_read_add_on_features(HciCommandFuture &reply, bt_device_soc_addon_features_t *soc, int to) {
+    if (!reply.valid()) {
+        probe_perror("Error reading add on features");
+        return -1;
+    }
 
-    if (stream) {
-        uint8_t sub_opcode;
-        STREAM_TO_UINT8(sub_opcode, stream);
-        if (sub_opcode == HCI_VS_QBCE_READ_LOCAL_QLL_SUPPORTED_FEATURES) {
-            uint8_t *arr = (uint8_t *) qll;
-            STREAM_TO_ARRAY(arr, stream, (int) sizeof(*qll));
+    // Controllers without the command fail or reject it; they have no
+    // add-on features
+    PacketRef event;
+    if (reply.get(&event, to) < 0) {
+        if (reply.rejected()) {
+            return 0;
         }
-    } else {
-        fprintf(stderr, "%s: stream null check cmnd status reason", __func__);
+        probe_perror("Read failed");
+        return -1;
+    }
+    QHS_LOGD_HEX("Add on features", event.data(), event.size());
+    ChromeTraceSpan span("decode_addon", HCI_VS_GET_ADDON_FEATURES_SUPPORT);
+    if (auto res = decode_add_on_features(event.span(), soc);
+        !res && res.error() != HCI_READ_FAILED) {
+        probe_err->printf("%s: %s\n", __func__, hci_read_error_str(res.error()));
         return -1;
     }
     return 0;
 }
 
-typedef struct {
-    uint8_t wipower : 1;
-    uint8_t scramble : 1;
-    uint8_t _44_1k : 1;
-    uint8_t _48k : 1;
-    uint8_t single_vs : 1;
-    uint8_t sbc_encoding : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-
-    uint8_t sbc_source : 1;
-    uint8_t mp3_source : 1;
-    uint8_t aac_source : 1;
-    uint8_t ldac_source : 1;
-    uint8_t aptx_source : 1;
-    uint8_t aptx_hd_source : 1;
-    uint8_t aptx_adaptive_source : 1;
-    uint8_t aptx_twsplus_source : 1;
-
-    uint8_t sbc_sink : 1;
-    uint8_t mp3_sink : 1;
-    uint8_t aac_sink : 1;
-    uint8_t ldac_sink : 1;
-    uint8_t aptx_sink : 1;
-    uint8_t aptx_hd_sink : 1;
-    uint8_t aptx_adaptive_sink : 1;
-    uint8_t aptx_twsplus_sink : 1;
-
-    uint8_t dual_sco : 1;
-    uint8_t dual_esco : 1;
-    uint8_t aptx_voice : 1;
-    uint8_t lhdc_source : 1;
-    uint8_t qle_hci: 1;
-    uint8_t qcm_hci: 1;
-    uint8_t aac_source_abr: 1;
-    uint8_t aptx_adaptive_source_split_tx : 1;
-
-    uint8_t broadcast_tx_25: 1;
-    uint8_t broadcast_tx_39: 1;
-    uint8_t broadcast_rx_25: 1;
-    uint8_t broadcast_rx_39: 1;
-    uint8_t iso_cig_param_calc: 1;
-    uint8_t bqr_ext : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-    uint8_t : 1;
-} bt_soc_addon_features_bitfields_t;
-
-static_assert(sizeof(bt_soc_addon_features_bitfields_t) == 8, " Bitfield size assumptions are incorrect");
-
-typedef struct {
-    uint16_t product_id;
-    uint16_t response_version;
-    uint8_t valid_bytes;
-    union {
-        bt_soc_addon_features_bitfields_t as_struct;
-        uint8_t as_array[256];
-    };
-} bt_device_soc_addon_features_t;
-
-#define SOC_ADDON_FEATURES_Fmt "product ID 0x%04x, response ver 0x%x, \n    " \
-                                BOOL_Fmt("WiPower") ", " BOOL_Fmt("Scrambling Required") ", " BOOL_Fmt("44.1 kHz") ", " BOOL_Fmt("48 kHz") ", " BOOL_Fmt("Single VS Command Support") ", " BOOL_Fmt("SBC encoding") ", \n    " \
-                                BOOL_Fmt("SBC Source") ", " BOOL_Fmt("MP3 Source") ", " BOOL_Fmt("AAC Source") ", " BOOL_Fmt("LDAC Source") ", " BOOL_Fmt("aptX Source") ", " BOOL_Fmt("aptX HD Source") ", " BOOL_Fmt("aptX Adaptive Source") ", " BOOL_Fmt("aptX TWS+ source") ", \n    " \
-                                BOOL_Fmt("SBC Sink") ", " BOOL_Fmt("MP3 Sink") ", " BOOL_Fmt("AAC Sink") ", " BOOL_Fmt("LDAC Sink") ", " BOOL_Fmt("aptX Sink") ", " BOOL_Fmt("aptX HD Sink") ", " BOOL_Fmt("aptX Adaptive Sink") ", " BOOL_Fmt("aptX TWS+ Sink") ", \n    " \
-                                BOOL_Fmt("Dual SCO") ", " BOOL_Fmt("Dual eSCO") ", " BOOL_Fmt("aptX Adaptive Voice") ", " BOOL_Fmt("LHDC Source") ", " BOOL_Fmt("QLE HCI") ", " BOOL_Fmt("QCM HCI") ", " BOOL_Fmt("AAC Source ABR") ", " BOOL_Fmt("aptX Adaptive Source Split TX") ", \n    " \
-                                BOOL_Fmt(" Broadcast Audio Tx with EC-2:5") ", " BOOL_Fmt(" Broadcast Audio Tx with EC-3:9") ", " BOOL_Fmt(" Broadcast Audio Rx with EC-2:5") ", " BOOL_Fmt(" Broadcast Audio Rx with EC-3:9") ", " BOOL_Fmt("ISO CIG Parameter Calculation") ", " BOOL_Fmt(" BQR Ext")
-
-#define SOC_ADDON_FEATURES_Arg(x) (x).product_id, (x).response_version, \
-                                  BOOL_Arg((x).as_struct.wipower), BOOL_Arg((x).as_struct.scramble), BOOL_Arg((x).as_struct._44_1k), BOOL_Arg((x).as_struct._48k), BOOL_Arg((x).as_struct.single_vs), BOOL_Arg((x).as_struct.sbc_encoding), \
-                                  BOOL_Arg((x).as_struct.sbc_source), BOOL_Arg((x).as_struct.mp3_source), BOOL_Arg((x).as_struct.aac_source), BOOL_Arg((x).as_struct.ldac_source), BOOL_Arg((x).as_struct.aptx_source), BOOL_Arg((x).as_struct.aptx_hd_source), BOOL_Arg((x).as_struct.aptx_adaptive_source), BOOL_Arg((x).as_struct.aptx_twsplus_source), \
-                                  BOOL_Arg((x).as_struct.sbc_sink), BOOL_Arg((x).as_struct.mp3_sink), BOOL_Arg((x).as_struct.aac_sink), BOOL_Arg((x).as_struct.ldac_sink), BOOL_Arg((x).as_struct.aptx_sink), BOOL_Arg((x).as_struct.aptx_hd_sink), BOOL_Arg((x).as_struct.aptx_adaptive_sink), BOOL_Arg((x).as_struct.aptx_twsplus_sink), \
-                                  BOOL_Arg((x).as_struct.dual_sco), BOOL_Arg((x).as_struct.dual_esco), BOOL_Arg((x).as_struct.aptx_voice), BOOL_Arg((x).as_struct.lhdc_source), BOOL_Arg((x).as_struct.qle_hci), BOOL_Arg((x).as_struct.qcm_hci), BOOL_Arg((x).as_struct.aac_source_abr), BOOL_Arg((x).as_struct.aptx_adaptive_source_split_tx), \
-                                  BOOL_Arg((x).as_struct.broadcast_tx_25), BOOL_Arg((x).as_struct.broadcast_tx_39), BOOL_Arg((x).as_struct.broadcast_rx_25), BOOL_Arg((x).as_struct.broadcast_rx_39), BOOL_Arg((x).as_struct.iso_cig_param_calc), BOOL_Arg((x).as_struct.bqr_ext)
-
-
+HciCommandFuture hci_request_local_version(HciDispatcher &hci) {
+    return hci.submit(HCI_OGF_INFORMATIONAL, HCI_OCF_READ_LOCAL_VERSION, 0, NULL);
+}
 
-int hci_read_add_on_features(int dd, bt_device_soc_addon_features_t *soc, int to) {
-    uint8_t buf[HCI_MAX_EVENT_SIZE] = {};
-    if (hci_send_cmd(dd, OGF_VS, OCF_VS_ADDON, 0, buf) < 0) {
-        perror("Error reading add on features");
+int hci_read_local_version_info(HciCommandFuture &reply, struct hci_version *ver, int to) {
+    if (!reply.valid()) {
         return -1;
     }
 
-    ssize_t len = 0;
-    if ((len = hci_read(dd, buf, sizeof(buf))) < 0) {
-        perror("Read failed");
+    PacketRef event;
+    if (reply.get(&event, to) < 0) {
         return -1;
     }
 
-    len -= 2;
-
-#ifdef DEBUG
-
-    printf("Add on features (len %zd)", len);
-    hexdump(": ", buf, len);
-
-#endif
-#ifndef __ANDROID__
-    uint8_t parameter_length = buf[1];
-    printf("LEN: %d\n", parameter_length);
-    uint8_t *stream = read_command_complete_header(&buf[1], NO_OPCODE_CHECKING, 0);
-#else
-    uint8_t parameter_length = len;
-    uint8_t *stream = read_command_complete_header(&buf[0], NO_OPCODE_CHECKING, 0);
-#endif
-
-    if (stream && (parameter_length > 8)) {
-      STREAM_TO_UINT16(soc->product_id, stream);
-      STREAM_TO_UINT16(soc->response_version, stream);
+    ChromeTraceSpan span("decode_version", HCI_READ_LOCAL_VERSION_OPCODE);
+    if (!decode_local_version(event.span(), ver)) {
+        errno = EIO;
+        return -1;
+    }
+    return 0;
+}
 
-      soc->valid_bytes = parameter_length - 8;
-      STREAM_TO_ARRAY(soc->as_array, stream, soc->valid_bytes);
+static int command_timeout_ms = DEFAULT_COMMAND_TIMEOUT_MS;
+static std::chrono::steady_clock::time_point probe_deadline;
+
+// --timings prints each probe's stages in its report, --timings-json dumps
+// them as JSON lines, --alloc-stats prints the heap use of each stage
+static bool timings_report;
+static FILE *timings_json;
+static bool alloc_report;
+
+// --cache=DIR remembers each adapter's Read Local Version result for
+// --cache-ttl seconds
+static const char *version_cache_dir;
+
+// --fd=N probes a descriptor that is already open, such as one end of a
+// socket pair served by the emulator. It is not an HCI socket, so it takes
+// no event filter, and the dispatcher sorts the events itself.
+static int probe_fd = -1;
+static int version_cache_ttl_s = VERSION_CACHE_DEFAULT_TTL_S;
+static thread_local ProbeTimings *probe_timings;
+
+// Records a stage that began at `start` and ends now, if timings are on
+static void probe_stage(const char *name, ProbeTimings::clock::time_point start) {
+    if (probe_timings != NULL) {
+        probe_timings->record(name, start);
     }
+}
 
-    return 0;
+// Time left of the whole probe's budget, in milliseconds
+static int probe_budget_left() {
+    auto left = std::chrono::ceil<std::chrono::milliseconds>(
+            probe_deadline - std::chrono::steady_clock::now()).count();
+    return left > 0 ? left : 0;
 }
 
+// How long to wait for one command's response without blowing the budget
+static int probe_timeout() {
+    int left = probe_budget_left();
+    return left < command_timeout_ms ? left : command_timeout_ms;
+}
 
 bool is_qti_controller(struct hci_version *ver) {
     for (size_t i = 0; i < ARRAY_SIZE(versions); i++) {
@@ -391,91 +240,574 @@ static const char *ver_map[] = {
 };
 
 
-int main(int argc, char **argv) {
-    int dev_id = hci_devid("hci0");
-    bdaddr_t addr;
-    struct hci_filter flt;
+// Vendor event sub-codes to let through the socket filter (--vendor-events)
+static uint8_t vendor_events[HCI_MAX_VENDOR_FILTER_EVENTS];
+static size_t vendor_event_count;
 
+static int parse_vendor_events(const char *list) {
+    char *end;
+    vendor_event_count = 0;
+    while (*list) {
+        unsigned long code = strtoul(list, &end, 0);
+        if (end == list || code > 0xff || vendor_event_count == HCI_MAX_VENDOR_FILTER_EVENTS) {
+            return -1;
+        }
+        vendor_events[vendor_event_count++] = code;
+        list = *end == ',' ? end + 1 : end;
+    }
+    return 0;
+}
 
-    if (hci_devba(dev_id, &addr) < 0) {
-        perror("hci0 is missing");
-        return 1;
+// Dumps the vendor events that arrived while waiting for the probe commands
+struct VendorEventPrinter : HciEventHandler {
+    const PacketRef *event;
+
+    void onVendorEvent(const hci_vendor_event_t &) {
+        probe_out->hex("Vendor event: ", event->data(), event->size());
     }
+};
 
-    printf("Local address: " BDADDR_Fmt"\n", BDADDR_Arg(addr));
+static void print_vendor_events(HciDispatcher &hci) {
+    PacketRef event;
+    VendorEventPrinter printer;
+    while (hci.nextUnsolicited(&event)) {
+        printer.event = &event;
+        hci_dispatch_event(event.span(), printer);
+    }
+}
 
-    struct hci_version ver = {};
+static void print_version(const struct hci_version &ver, bool qti) {
+    probe_out->printf("HCI version %s (0x%x), revision 0x%x\n", ver_map[ver.hci_ver], ver.hci_ver, ver.hci_rev);
+    probe_out->printf("LMP version %s (0x%x), subversion 0x%x\n", ver_map[ver.lmp_ver], ver.lmp_ver, ver.lmp_subver);
+    probe_out->printf("Manufacturer is %s (0x%x)\n", bt_compid_name(ver.manufacturer), ver.manufacturer);
 
-    int dd = -1;
+    probe_out->printf("QTI vendor commands %s\n", qti ? "*should* be supported" : "are definitely not supported");
 
-    if ((dd = hci_open_dev(dev_id)) < 0) {
-        fprintf(stderr, "Can't open device hci%d", dev_id);
-        perror("");
-        return 1;
+    if (!qti) {
+        probe_out->printf("Not QTI controller, nothing more to do\n");
     }
+}
+
+// Runs the version check and, on QTI parts, the vendor feature queries on
+// an open controller. With a cached version the vendor queries go out
+// straight away.
+static int probe_controller(int dd, const char *cache_key, const struct hci_version *cached) {
+    struct hci_version ver = {};
+    HciDispatcher hci(dd);
+    auto start = ProbeTimings::clock::now();
 
     /* Setup filter */
-#ifndef __ANDROID__
-    hci_filter_clear(&flt);
-    hci_filter_set_ptype(HCI_EVENT_PKT, &flt);
-    hci_filter_all_events(&flt);
-    if (setsockopt(dd, SOL_HCI, HCI_FILTER, &flt, sizeof(flt)) < 0) {
-        perror("HCI filter setup failed");
+    if (probe_fd < 0 && (hci.enableEventFilter(vendor_event_count > 0) < 0 ||
+        (vendor_event_count > 0 &&
+         hci_attach_vendor_filter(dd, vendor_events, vendor_event_count) < 0))) {
+        probe_perror("HCI filter setup failed");
         return 0;
     }
-#else
-    while(!initialization_complete) {}
-    printf("Init done\n");
-#endif
-    hci_read_local_version(dd, &ver, 1000);
+    probe_stage("filter", start);
 
-    printf("HCI version %s (0x%x), revision 0x%x\n", ver_map[ver.hci_ver], ver.hci_ver, ver.hci_rev);
-    printf("LMP version %s (0x%x), subversion 0x%x\n", ver_map[ver.lmp_ver], ver.lmp_ver, ver.lmp_subver);
-    printf("Manufacturer is %s (0x%x)\n", bt_compidtostr(ver.manufacturer), ver.manufacturer);
+    if (cached != NULL) {
+        ver = *cached;
+    } else {
+        start = ProbeTimings::clock::now();
+        HciCommandFuture version_reply = hci_request_local_version(hci);
+        if (hci_read_local_version_info(version_reply, &ver, probe_timeout()) < 0) {
+            probe_perror("Can't read version info");
+            return 1;
+        }
+        probe_stage("version", start);
 
-    printf("QTI vendor commands %s\n", is_qti_controller(&ver) ? "*should* be supported" : "are definitely not supported");
+        if (version_cache_dir != NULL && cache_key != NULL && version_cache_store(version_cache_dir, cache_key, &ver) < 0) {
+            QHS_LOGW("Can't update version cache in %s: %s", version_cache_dir, strerror(errno));
+        }
+    }
 
-    if (!is_qti_controller(&ver)) {
-        printf("Not QTI controller, nothing more to do\n");
-        hci_close_dev(dd);
+    bool qti = is_qti_controller(&ver);
+    print_version(ver, qti);
+    if (!qti) {
         return 0;
     }
 
+    start = ProbeTimings::clock::now();
+    HciCommandFuture addon_reply = hci_request_add_on_features(hci);
+
     bt_device_soc_addon_features_t soc = {};
 
-    if (hci_read_add_on_features(dd, &soc, 1000) < 0) {
+    if (hci_read_add_on_features(addon_reply, &soc, probe_timeout()) < 0) {
         return 1;
     }
+    probe_stage("addon", start);
 
-    printf("Device SOC features: \n    " SOC_ADDON_FEATURES_Fmt "\n", SOC_ADDON_FEATURES_Arg(soc));
-
+    probe_out->printf("Device SOC features: product ID 0x%04x, response ver 0x%x\n",
+                      soc.product_id, soc.response_version);
+    probe_out->features("Add-on features", soc.as_array, addon_feature_names,
+                        FEATURE_NAMES_COUNT(addon_feature_names));
 
     if (soc.as_struct.qle_hci == 0 ) {
-        printf("Old device, QLE HCI is not supported, nothing more to do\n");
-        hci_close_dev(dd);
+        probe_out->printf("Old device, QLE HCI is not supported, nothing more to do\n");
         return 0;
     }
 
+    // Only parts with QLE HCI know the QBCE commands; older firmware may drop
+    // them or raise a Hardware Error. Both go out together, the dispatcher
+    // keeps as many in flight as the controller grants credits for.
+    start = ProbeTimings::clock::now();
+    HciCommandFuture qll_reply = hci_request_local_qll_features(hci);
+    HciCommandFuture qlmp_reply = hci_request_local_qlmp_features(hci);
+
     qll_feature_set_t qll = {};
 
-    if (hci_read_local_qll_features(dd, &qll, 1000) < 0) {
+    if (hci_read_local_qll_features(qll_reply, &qll, probe_timeout()) < 0) {
         return 1;
     }
+    probe_stage("qll", start);
 
-    printf("QLMP features: \n    " QLL_FEATURE_SET_Fmt "\n", QLL_FEATURE_SET_Arg(qll));
+    probe_out->features("QLL features", (const uint8_t *) &qll, qll_feature_names,
+                        FEATURE_NAMES_COUNT(qll_feature_names));
 
+    qlmp_feature_set_t qlmp = {};
 
+    if (hci_read_local_qlmp_features(qlmp_reply, &qlmp, probe_timeout()) < 0) {
+        return 1;
+    }
+    probe_stage("qlmp", start);
 
-    qlmp_feature_set_t qlmp = {};
+    probe_out->features("QLMP features", (const uint8_t *) &qlmp, qlmp_feature_names,
+                        FEATURE_NAMES_COUNT(qlmp_feature_names));
+
+    if (vendor_event_count > 0) {
+        print_vendor_events(hci);
+    }
+    return 0;
+}
+
+// --stress: one command issued over and over instead of the probe
+static const struct {
+    const char *name;
+    HciCommandFuture (*request)(HciDispatcher &hci);
+} stress_commands[] = {
+    { "qll",     hci_request_local_qll_features },
+    { "qlmp",    hci_request_local_qlmp_features },
+    { "addon",   hci_request_add_on_features },
+    { "version", hci_request_local_version },
+};
+
+static int stress_command = -1;
+static int stress_count = DEFAULT_STRESS_COUNT;
+static int stress_depth = 1;
+
+static int parse_stress_command(const char *name) {
+    for (size_t i = 0; i < ARRAY_SIZE(stress_commands); i++) {
+        if (strcmp(name, stress_commands[i].name) == 0) {
+            stress_command = i;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+// Issues the stress command stress_count times with up to stress_depth of
+// them in flight and reports the command to Command Complete round trips.
+// Each command gets the full --timeout, --budget does not apply.
+static int stress_controller(int dd) {
+    HciDispatcher hci(dd);
+    HciCommandFuture replies[HCI_MAX_PENDING_COMMANDS];
+    LatencyHistogram histogram;
+    int submitted = 0, completed = 0, failed = 0;
+
+    if (probe_fd < 0 && hci.enableEventFilter(false) < 0) {
+        probe_perror("HCI filter setup failed");
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    while (completed < stress_count) {
+        while (submitted < stress_count && submitted - completed < stress_depth) {
+            replies[submitted++ % stress_depth] = stress_commands[stress_command].request(hci);
+        }
+
+        PacketRef event;
+        std::chrono::nanoseconds round_trip;
+        HciCommandFuture &reply = replies[completed++ % stress_depth];
+        if (!reply.valid() || reply.get(&event, command_timeout_ms, &round_trip) < 0 ||
+            event.size() < 6 || event.data()[5] != HCI_SUCCESS) {
+            failed++;
+            continue;
+        }
+        histogram.record(round_trip.count());
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    probe_out->printf("Stress: %d x %s, depth %d: %d failed in %.1f ms, %.0f cmd/s\n",
+                      stress_count, stress_commands[stress_command].name, stress_depth, failed,
+                      elapsed * 1e3, (completed - failed) / elapsed);
+    probe_out->printf("Round trip (us): min %.1f, p50 %.1f, p99 %.1f, p99.9 %.1f, max %.1f, mean %.1f\n",
+                      histogram.min() / 1e3, histogram.percentile(50) / 1e3, histogram.percentile(99) / 1e3,
+                      histogram.percentile(99.9) / 1e3, histogram.max() / 1e3, histogram.mean() / 1e3);
+    return failed > 0 ? 1 : 0;
+}
+
+// Ends the probe's timings and reports them
+static void report_timings() {
+    if (probe_timings == NULL) {
+        return;
+    }
+    probe_stage("total", probe_timings->started());
+    if (timings_report) {
+        probe_timings->print(*probe_out);
+    }
+    if (alloc_report) {
+        probe_timings->printAllocations(*probe_out);
+    }
+    if (timings_json != NULL) {
+        probe_timings->dump(timings_json);
+    }
+}
+
+// Names the cache entry of an adapter. On Linux that is the adapter and its
+// address. The HAL reports no address, but its controller is built into the
+// device, so there the key is the build: only an update can change the
+// firmware or the controller behind the HAL.
+static void version_cache_key(char *key, size_t size, int dev_id, const bdaddr_t &addr) {
+#ifndef __ANDROID__
+    snprintf(key, size, "hci%d-%02X%02X%02X%02X%02X%02X", dev_id, BDADDR_Arg(addr));
+#else
+    (void) dev_id;
+    (void) addr;
+    char fingerprint[PROP_VALUE_MAX] = "";
+    __system_property_get("ro.build.fingerprint", fingerprint);
+    // FNV-1a, the fingerprint holds slashes and is too long for a file name
+    uint64_t hash = 0xcbf29ce484222325;
+    for (const char *c = fingerprint; *c; c++) {
+        hash = (hash ^ (uint8_t) *c) * 0x100000001b3;
+    }
+    snprintf(key, size, "hal-%016llx", (unsigned long long) hash);
+#endif
+}
+
+static int probe_adapter(int dev_id) {
+    bdaddr_t addr;
 
-    if (hci_read_local_qlmp_features(dd, &qlmp, 1000) < 0) {
+    if (probe_fd >= 0) {
+        return stress_command >= 0 ? stress_controller(probe_fd)
+                                   : probe_controller(probe_fd, NULL, NULL);
+    }
+
+    if (hci_devba(dev_id, &addr) < 0) {
+        probe_err->printf("hci%d is missing: %s\n", dev_id, strerror(errno));
         return 1;
     }
 
-    printf("QLMP features: \n    " QLMP_FEATURE_SET_Fmt "\n", QLMP_FEATURE_SET_Arg(qlmp));
+    probe_out->printf("Local address: " BDADDR_Fmt"\n", BDADDR_Arg(addr));
+
+    // A controller known not to be a QTI part is not worth opening, which
+    // on Android also saves the firmware download
+    char cache_key[32];
+    version_cache_key(cache_key, sizeof(cache_key), dev_id, addr);
+    struct hci_version cached;
+    bool have_cached = false;
+    auto start = ProbeTimings::clock::now();
+    if (version_cache_dir != NULL && stress_command < 0) {
+        have_cached = version_cache_load(version_cache_dir, cache_key, version_cache_ttl_s, &cached) == 0;
+        probe_stage("cache", start);
+        if (have_cached && !is_qti_controller(&cached)) {
+            print_version(cached, false);
+            return 0;
+        }
+    }
+
+    int dd = -1;
+    start = ProbeTimings::clock::now();
 
+    if ((dd = hci_open_dev(dev_id)) < 0) {
+        probe_err->printf("Can't open device hci%d: %s\n", dev_id, strerror(errno));
+        return 1;
+    }
+    probe_stage("open", start);
+
+#ifdef __ANDROID__
+    // Firmware download happens here
+    start = ProbeTimings::clock::now();
+    {
+        ChromeTraceSpan span("hal_init");
+        if (hci_wait_initialization(probe_budget_left()) < 0) {
+            probe_perror("HAL initialization failed");
+            hci_close_dev(dd);
+            return 1;
+        }
+    }
+    probe_stage("hal_init", start);
+    probe_out->printf("Init done\n");
+#endif
+
+    int ret = stress_command >= 0 ? stress_controller(dd)
+                                  : probe_controller(dd, cache_key, have_cached ? &cached : NULL);
     hci_close_dev(dd);
-    return 0;
+    return ret;
+}
+
+// Probes one adapter, timing the probe when asked to
+static int timed_probe_adapter(const char *name) {
+    ProbeTimings timings(name);
+    if (timings_report || timings_json != NULL || alloc_report) {
+        probe_timings = &timings;
+    }
+
+    // On Android this connects to the HAL service
+    auto start = ProbeTimings::clock::now();
+    int dev_id = hci_devid(name);
+    probe_stage("lookup", start);
+
+    int ret = probe_adapter(dev_id);
+    report_timings();
+    probe_timings = NULL;
+    return ret;
+}
+
+#ifndef __ANDROID__
+// Lists the adapters the kernel knows about, in dev_id order
+static int list_adapters(int *ids, int max) {
+    int ctl = socket(AF_BLUETOOTH, SOCK_RAW | SOCK_CLOEXEC, BTPROTO_HCI);
+    if (ctl < 0) {
+        return -1;
+    }
+
+    alignas(struct hci_dev_req) uint8_t buf[sizeof(struct hci_dev_list_req) + HCI_MAX_DEV * sizeof(struct hci_dev_req)] = {};
+    struct hci_dev_list_req *dl = (struct hci_dev_list_req *) buf;
+    dl->dev_num = HCI_MAX_DEV;
+
+    if (ioctl(ctl, HCIGETDEVLIST, (void *) dl) < 0) {
+        close(ctl);
+        return -1;
+    }
+    close(ctl);
+
+    struct hci_dev_req *dr = dl->dev_req;
+    int n = 0;
+    for (int i = 0; i < dl->dev_num && n < max; i++, dr++) {
+        ids[n++] = dr->dev_id;
+    }
+    std::sort(ids, ids + n);
+    return n;
+}
+
+// Probes every adapter at once, one thread each, and prints the reports in
+// dev_id order once all of them are done. The heap counters are process-wide,
+// so with --alloc-stats the probes run one after the other instead.
+static int probe_all_adapters() {
+    int ids[HCI_MAX_DEV];
+    int n = list_adapters(ids, HCI_MAX_DEV);
+    if (n < 0) {
+        perror("Can't list adapters");
+        return 1;
+    }
+    if (n == 0) {
+        fprintf(stderr, "No adapters found\n");
+        return 1;
+    }
+
+    std::unique_ptr<ReportWriter> reports[HCI_MAX_DEV];
+    int rets[HCI_MAX_DEV] = {};
+    std::thread workers[HCI_MAX_DEV];
+
+    for (int i = 0; i < n; i++) {
+        reports[i].reset(new ReportWriter(report_colour));
+        workers[i] = std::thread([report = reports[i].get(), &ret = rets[i], dev_id = ids[i]] {
+            probe_out = probe_err = report;
+            char name[16];
+            snprintf(name, sizeof(name), "hci%d", dev_id);
+            report->printf("%s:\n", name);
+            ret = timed_probe_adapter(name);
+        });
+        if (alloc_report) {
+            workers[i].join();
+        }
+    }
+
+    int ret = 0;
+    for (int i = 0; i < n; i++) {
+        if (workers[i].joinable()) {
+            workers[i].join();
+        }
+        if (reports[i]->flush(STDOUT_FILENO) < 0) {
+            ret = 1;
+        }
+        ret |= rets[i];
+    }
+    return ret;
+}
+#endif
+
+static int run_probes(const char *device, bool all) {
+#ifndef __ANDROID__
+    if (all) {
+        return probe_all_adapters();
+    }
+#else
+    // There is only the one controller behind the HAL
+    (void) all;
+#endif
+
+    ReportWriter out(report_colour), err(false);
+    probe_out = &out;
+    probe_err = &err;
+    int ret = timed_probe_adapter(device);
+    probe_out = probe_err = NULL;
+    if (out.flush(STDOUT_FILENO) < 0 || err.flush(STDERR_FILENO) < 0) {
+        ret = 1;
+    }
+    return ret;
+}
+
+static void usage(const char *name) {
+    printf("Usage: %s [options]\n"
+           "  -t, --timeout=MS   wait at most MS for each command (default %d)\n"
+           "  -b, --budget=MS    give up when the whole probe takes longer (default %d)\n"
+           "  -i, --device=hciX  probe this adapter (default hci0)\n"
+           "  -a, --all          probe every adapter concurrently\n"
+           "  -e, --vendor-events=SUB[,SUB...]\n"
+           "                     also collect vendor events with these sub-codes\n"
+           "  -s, --stress=CMD   send CMD (qll, qlmp, addon or version) over and over\n"
+           "                     and report round-trip latency instead of probing\n"
+           "  -n, --count=N      stress commands to send (default %d)\n"
+           "  -d, --depth=N      stress commands kept in flight, up to %d (default 1)\n"
+           "      --trace=FILE   write a Chrome trace of the HCI traffic to FILE\n"
+           "      --color=WHEN   colour the features: auto, always or never (default auto)\n"
+           "  -T, --timings      report how long each stage of the probe took\n"
+           "      --timings-json=FILE\n"
+           "                     append the stage timings to FILE as JSON lines (- for stdout)\n"
+           "      --alloc-stats  report heap allocations and peak heap use of each stage\n"
+           "      --cache=DIR    remember each adapter's version in DIR and skip\n"
+           "                     reading it again while fresh\n"
+           "      --cache-ttl=S  how long a remembered version is fresh (default %d)\n"
+#ifndef __ANDROID__
+           "      --fd=N         probe the open descriptor N, e.g. a socket pair served\n"
+           "                     by qhs-emu --fd, instead of an adapter (for testing)\n"
+#endif
+           "  -h, --help         show this help\n",
+           name, DEFAULT_COMMAND_TIMEOUT_MS, DEFAULT_PROBE_BUDGET_MS,
+           DEFAULT_STRESS_COUNT, HCI_MAX_PENDING_COMMANDS, VERSION_CACHE_DEFAULT_TTL_S);
+}
+
+int main(int argc, char **argv) {
+    static const struct option options[] = {
+        { "timeout", required_argument, NULL, 't' },
+        { "budget",  required_argument, NULL, 'b' },
+        { "device",  required_argument, NULL, 'i' },
+        { "all",     no_argument,       NULL, 'a' },
+        { "vendor-events", required_argument, NULL, 'e' },
+        { "stress",  required_argument, NULL, 's' },
+        { "count",   required_argument, NULL, 'n' },
+        { "depth",   required_argument, NULL, 'd' },
+        { "timings", no_argument,       NULL, 'T' },
+        { "timings-json", required_argument, NULL, 'J' },
+        { "trace",   required_argument, NULL, 'R' },
+        { "color",   required_argument, NULL, 'C' },
+        { "alloc-stats", no_argument,   NULL, 'A' },
+        { "cache",   required_argument, NULL, 'c' },
+        { "cache-ttl", required_argument, NULL, 'L' },
+#ifndef __ANDROID__
+        { "fd",      required_argument, NULL, 'F' },
+#endif
+        { "help",    no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+    int budget_ms = DEFAULT_PROBE_BUDGET_MS;
+    const char *device = "hci0";
+    const char *trace_path = NULL;
+    bool all = false;
+    int opt;
+
+    report_colour = isatty(STDOUT_FILENO);
+
+    while ((opt = getopt_long(argc, argv, "t:b:i:ae:s:n:d:Th", options, NULL)) != -1) {
+        switch (opt) {
+        case 't':
+            command_timeout_ms = atoi(optarg);
+            break;
+        case 'b':
+            budget_ms = atoi(optarg);
+            break;
+        case 'i':
+            device = optarg;
+            break;
+        case 'a':
+            all = true;
+            break;
+        case 'e':
+            if (parse_vendor_events(optarg) < 0) {
+                fprintf(stderr, "Invalid vendor event list: %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 's':
+            if (parse_stress_command(optarg) < 0) {
+                fprintf(stderr, "Unknown stress command: %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 'n':
+            stress_count = atoi(optarg);
+            break;
+        case 'd':
+            stress_depth = std::clamp(atoi(optarg), 1, HCI_MAX_PENDING_COMMANDS);
+            break;
+        case 'T':
+            timings_report = true;
+            break;
+        case 'J':
+            timings_json = strcmp(optarg, "-") == 0 ? stdout : fopen(optarg, "a");
+            if (timings_json == NULL) {
+                perror("Can't open timings file");
+                return 1;
+            }
+            break;
+        case 'R':
+            trace_path = optarg;
+            break;
+        case 'A':
+            alloc_report = true;
+            alloc_stats_enabled.store(true, std::memory_order_relaxed);
+            break;
+        case 'c':
+            version_cache_dir = optarg;
+            break;
+        case 'L':
+            version_cache_ttl_s = atoi(optarg);
+            break;
+        case 'F':
+            probe_fd = atoi(optarg);
+            break;
+        case 'C':
+            if (strcmp(optarg, "always") == 0) {
+                report_colour = true;
+            } else if (strcmp(optarg, "never") == 0) {
+                report_colour = false;
+            } else if (strcmp(optarg, "auto") != 0) {
+                fprintf(stderr, "Invalid colour mode: %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 'h':
+            usage(argv[0]);
+            return 0;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    probe_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(budget_ms);
+    if (trace_path != NULL) {
+        chrome_trace_start();
+    }
+
+    int ret = run_probes(device, all);
+
+    if (trace_path != NULL && chrome_trace_write(trace_path) < 0) {
+        perror("Can't write trace");
+        ret = 1;
+    }
+    return ret;
 }
 
 
@@ -490,13 +822,15 @@ int main1() {
         .qhs_p5 = 1//, .qhs_p4 = 1, .qhs_p3 = 1, .bredr_qhs_p2 = 1,
     };
 
-    printf("QLMP features: \n    " QLMP_FEATURE_SET_Fmt "\n", QLMP_FEATURE_SET_Arg(qlmp));
+    ReportWriter out(true);
+    out.features("QLMP features", (const uint8_t *) &qlmp, qlmp_feature_names, FEATURE_NAMES_COUNT(qlmp_feature_names));
 
     uint8_t buf[16];
 
     memcpy(buf, &qlmp, 16);
 
-    hexdump("QLMP: ", buf, 16);
+    out.hex("QLMP: ", buf, 16);
+    out.flush(STDOUT_FILENO);
 
     return 0;
 }
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <algorithm>
+
+#include "hci_parser.h"
+#include "report_writer.h"
+
+typedef struct {
+    uint8_t split_acl : 1;
+    uint8_t tws_esco : 1;
+    uint8_t esco_dtx : 1;
+    uint8_t high_level_ch_msg : 1;
+    uint8_t bredr_qhs_p2 : 1;
+    uint8_t qhs_p3 : 1;
+    uint8_t qhs_p4 : 1;
+    uint8_t qhs_p5 : 1;
+
+    uint8_t qhs_p6 : 1;
+    uint8_t rtp_burst : 1;
+    uint8_t frozen_clk : 1;
+    uint8_t rt_soft_comb : 1;
+    uint8_t nonce : 1;
+    uint8_t reserved1 : 3;
+
+    uint8_t reserved2[14];
+}  __attribute__ ((__packed__)) qlmp_feature_set_t;
+
+typedef struct {
+    uint8_t status;
+    qbce_cmd_opcode_t opcode;
+    union {
+        qlmp_feature_set_t qlmp;
+    };
+} __attribute__ ((packed)) qbce_event_t;
+
+typedef struct {
+    uint8_t qll_hs_p2_tx : 1;
+    uint8_t qll_hs_p3_tx : 1;
+    uint8_t qll_hs_p4_tx : 1;
+    uint8_t qll_hs_p5_tx : 1;
+    uint8_t qll_hs_p6_tx : 1;
+    uint8_t qll_hs_p2_rx : 1;
+    uint8_t qll_hs_p3_rx : 1;
+    uint8_t qll_hs_p4_rx : 1;
+
+    uint8_t qll_hs_p5_rx : 1;
+    uint8_t qll_hs_p6_rx : 1;
+    uint8_t qll_hs_f2_tx : 1;
+    uint8_t qll_hs_f3_tx : 1;
+    uint8_t qll_hs_f4_tx : 1;
+    uint8_t qll_hs_f5_tx : 1;
+    uint8_t qll_hs_f6_tx : 1;
+    uint8_t qll_hs_f2_rx : 1;
+
+    uint8_t qll_hs_f3_rx  : 1;
+    uint8_t qll_hs_f4_rx  : 1;
+    uint8_t qll_hs_f5_rx  : 1;
+    uint8_t qll_hs_f6_rx  : 1;
+    uint8_t rtsc          : 1;
+    uint8_t reserved1     : 1;
+    uint8_t qll_ext_iso   : 1;
+    uint8_t qll_ext_isoal : 1;
+
+    uint8_t qll_le_edph          : 1;
+    uint8_t reserved3           : 1;
+    uint8_t qll_ft_change       : 1;
+    uint8_t qll_bn_var_qhs_rate : 1;
+    uint8_t reserved2           : 4;
+
+    uint8_t reserved4[3];
+
+    uint8_t reserved6 : 5;
+    uint8_t qll_xpan  : 1;
+    uint8_t reserved5 : 2;
+}  __attribute__ ((__packed__)) qll_feature_set_t;
+
+typedef struct {
+    uint8_t wipower : 1;
+    uint8_t scramble : 1;
+    uint8_t _44_1k : 1;
+    uint8_t _48k : 1;
+    uint8_t single_vs : 1;
+    uint8_t sbc_encoding : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+
+    uint8_t sbc_source : 1;
+    uint8_t mp3_source : 1;
+    uint8_t aac_source : 1;
+    uint8_t ldac_source : 1;
+    uint8_t aptx_source : 1;
+    uint8_t aptx_hd_source : 1;
+    uint8_t aptx_adaptive_source : 1;
+    uint8_t aptx_twsplus_source : 1;
+
+    uint8_t sbc_sink : 1;
+    uint8_t mp3_sink : 1;
+    uint8_t aac_sink : 1;
+    uint8_t ldac_sink : 1;
+    uint8_t aptx_sink : 1;
+    uint8_t aptx_hd_sink : 1;
+    uint8_t aptx_adaptive_sink : 1;
+    uint8_t aptx_twsplus_sink : 1;
+
+    uint8_t dual_sco : 1;
+    uint8_t dual_esco : 1;
+    uint8_t aptx_voice : 1;
+    uint8_t lhdc_source : 1;
+    uint8_t qle_hci: 1;
+    uint8_t qcm_hci: 1;
+    uint8_t aac_source_abr: 1;
+    uint8_t aptx_adaptive_source_split_tx : 1;
+
+    uint8_t broadcast_tx_25: 1;
+    uint8_t broadcast_tx_39: 1;
+    uint8_t broadcast_rx_25: 1;
+    uint8_t broadcast_rx_39: 1;
+    uint8_t iso_cig_param_calc: 1;
+    uint8_t bqr_ext : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+    uint8_t : 1;
+} bt_soc_addon_features_bitfields_t;
+
+static_assert(sizeof(bt_soc_addon_features_bitfields_t) == 8, " Bitfield size assumptions are incorrect");
+
+typedef struct {
+    uint16_t product_id;
+    uint16_t response_version;
+    uint8_t valid_bytes;
+    union {
+        bt_soc_addon_features_bitfields_t as_struct;
+        uint8_t as_array[256];
+    };
+} bt_device_soc_addon_features_t;
+
+// Names of the feature bits, in the order they are reported. The line
+// numbers group them into output lines.
+
+static const feature_name_t qlmp_feature_names[] = {
+    {"QHS 2M/BR/EDR", 4, 0}, {"QHS 3M", 5, 0}, {"QHS 4M", 6, 0}, {"QHS 5M", 7, 0}, {"QHS 6M", 8, 0},
+    {"Higher Layer Channel Messages", 3, 0},
+    {"eSCO DTX", 2, 1}, {"TWS eSCO", 1, 1}, {"Split ACL", 0, 1},
+    {"BR/EDR Packet Emulation Mode separate ACL and eSCO nonce support", 12, 2},
+    {"Real Time Soft Combining", 11, 3}, {"Frozen CLK eSCO Nonce Format", 10, 3},
+    {"Round Trip Phase measurement burst support", 9, 4},
+};
+
+static const feature_name_t qll_feature_names[] = {
+    {"HS PSK 2M TX", 0, 0}, {"HS PSK 3M TX", 1, 0}, {"HS PSK 4M TX", 2, 0}, {"HS PSK 5M TX", 3, 0},
+    {"HS PSK 6M TX", 4, 0}, {"HS PSK 2M RX", 5, 0}, {"HS PSK 3M RX", 6, 0}, {"HS PSK 4M RX", 7, 0},
+    {"HS PSK 5M RX", 8, 1}, {"HS PSK 6M RX", 9, 1}, {"HS FSK 2M TX", 10, 1}, {"HS FSK 3M TX", 11, 1},
+    {"HS FSK 4M TX", 12, 1}, {"HS FSK 5M TX", 13, 1}, {"HS FSK 6M TX", 14, 1}, {"HS FSK 2M RX", 15, 1},
+    {"HS FSK 3M RX", 16, 2}, {"HS FSK 4M RX", 17, 2}, {"HS FSK 5M RX", 18, 2}, {"HS FSK 6M RX", 19, 2},
+    {"RTSC", 20, 2}, {"Extended ISO", 22, 2}, {"Extended ISOAL", 23, 2},
+    {"BN Variation by QHS Rate", 27, 3}, {"FT Change", 26, 3}, {"LE EDPH", 24, 3},
+    {"XPAN support in host", 61, 3},
+};
+
+static const feature_name_t addon_feature_names[] = {
+    {"WiPower", 0, 0}, {"Scrambling Required", 1, 0}, {"44.1 kHz", 2, 0}, {"48 kHz", 3, 0},
+    {"Single VS Command Support", 4, 0}, {"SBC encoding", 5, 0},
+    {"SBC Source", 8, 1}, {"MP3 Source", 9, 1}, {"AAC Source", 10, 1}, {"LDAC Source", 11, 1},
+    {"aptX Source", 12, 1}, {"aptX HD Source", 13, 1}, {"aptX Adaptive Source", 14, 1},
+    {"aptX TWS+ source", 15, 1},
+    {"SBC Sink", 16, 2}, {"MP3 Sink", 17, 2}, {"AAC Sink", 18, 2}, {"LDAC Sink", 19, 2},
+    {"aptX Sink", 20, 2}, {"aptX HD Sink", 21, 2}, {"aptX Adaptive Sink", 22, 2},
+    {"aptX TWS+ Sink", 23, 2},
+    {"Dual SCO", 24, 3}, {"Dual eSCO", 25, 3}, {"aptX Adaptive Voice", 26, 3}, {"LHDC Source", 27, 3},
+    {"QLE HCI", 28, 3}, {"QCM HCI", 29, 3}, {"AAC Source ABR", 30, 3},
+    {"aptX Adaptive Source Split TX", 31, 3},
+    {"Broadcast Audio Tx with EC-2:5", 32, 4}, {"Broadcast Audio Tx with EC-3:9", 33, 4},
+    {"Broadcast Audio Rx with EC-2:5", 34, 4}, {"Broadcast Audio Rx with EC-3:9", 35, 4},
+    {"ISO CIG Parameter Calculation", 36, 4}, {"BQR Ext", 37, 4},
+};
+
+#define FEATURE_NAMES_COUNT(x) (sizeof(x) / sizeof((x)[0]))
+
+// Decoders for the Command Complete events of the QTI vendor commands, from
+// the event code on. They fail with HCI_READ_FAILED if the controller failed
+// the command, and with the reader's error if the event is malformed.
+
+inline hci_result_t decode_qlmp_features(std::span<const uint8_t> event, qlmp_feature_set_t *qlmp) {
+    HciReader stream;
+    HCI_CHECK(read_command_complete(event, HCI_VS_QBCE_OCF, 1 + sizeof(*qlmp), &stream));
+
+    uint8_t sub_opcode;
+    HCI_READ(sub_opcode, stream.u8());
+    if (sub_opcode == HCI_VS_QBCE_READ_LOCAL_QLM_SUPPORTED_FEATURES) {
+        HCI_CHECK(stream.copy(qlmp, sizeof(*qlmp)));
+    }
+    return {};
+}
+
+inline hci_result_t decode_qll_features(std::span<const uint8_t> event, qll_feature_set_t *qll) {
+    HciReader stream;
+    HCI_CHECK(read_command_complete(event, HCI_VS_QBCE_OCF, 1 + sizeof(*qll), &stream));
+
+    uint8_t sub_opcode;
+    HCI_READ(sub_opcode, stream.u8());
+    if (sub_opcode == HCI_VS_QBCE_READ_LOCAL_QLL_SUPPORTED_FEATURES) {
+        HCI_CHECK(stream.copy(qll, sizeof(*qll)));
+    }
+    return {};
+}
+
+inline hci_result_t decode_add_on_features(std::span<const uint8_t> event,
+                                           bt_device_soc_addon_features_t *soc) {
+    HciReader stream;
+    HCI_CHECK(read_command_complete(event, NO_OPCODE_CHECKING, 0, &stream));
+
+    // Product ID and response version, then as many feature bytes as the
+    // controller knows about
+    if (stream.remaining() > 4) {
+        HCI_READ(soc->product_id, stream.u16());
+        HCI_READ(soc->response_version, stream.u16());
+
+        soc->valid_bytes = std::min(stream.remaining(), sizeof(soc->as_array));
+        HCI_CHECK(stream.copy(soc->as_array, soc->valid_bytes));
+    }
+    return {};
+}
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <errno.h>
+#include <poll.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "hci_parser.h"
+
+#define H4_COMMAND_PKT 0x01
+#define H4_EVENT_PKT 0x04
+
+#define HCI_OCF_READ_BUFFER_SIZE 0x0005
+#define HCI_OCF_READ_BD_ADDR 0x0009
+
+#define QTI_EMU_MAX_ERRORS 16
+#define QTI_EMU_MAX_EVENT_SIZE (1 + 2 + 255)
+#define QTI_EMU_MAX_COMMAND_SIZE (1 + 3 + 255)
+#define QTI_EMU_MAX_QUEUED 32
+
+// Any sub-opcode matches the error override
+#define QTI_EMU_ANY_SUB_OPCODE -1
+
+typedef struct {
+    uint16_t opcode;
+    int sub_opcode;
+    uint8_t status;
+} qti_emu_error_t;
+
+typedef struct {
+    uint8_t bdaddr[6];
+
+    uint8_t hci_ver;
+    uint16_t hci_rev;
+    uint8_t lmp_ver;
+    uint16_t manufacturer;
+    uint16_t lmp_subver;
+
+    uint16_t product_id;
+    uint16_t response_version;
+    uint8_t addon_features[8];
+    uint8_t qll_features[8];
+    uint8_t qlmp_features[16];
+
+    // Num_HCI_Command_Packets reported in every completion. The emulator
+    // answers any number of commands concurrently regardless.
+    uint8_t credits;
+    // Time the controller takes to answer each command
+    unsigned latency_us;
+
+    // Commands failed with a Command Status carrying `status`
+    qti_emu_error_t errors[QTI_EMU_MAX_ERRORS];
+    size_t error_count;
+} qti_emu_config_t;
+
+// A QCA6390-like controller: QTI, BT 5.2, QLE HCI and every QHS rate
+inline qti_emu_config_t qti_emu_default_config() {
+    qti_emu_config_t config = {
+        .bdaddr = { 0x56, 0x34, 0x12, 0x00, 0x5b, 0x00 },
+        .hci_ver = 0x0b,
+        .hci_rev = 0x0000,
+        .lmp_ver = 0x0b,
+        .manufacturer = 0x001d,
+        .lmp_subver = 0x587b,
+        .product_id = 0x0013,
+        .response_version = 0x0002,
+        .addon_features = { 0x1f, 0x7f, 0x7f, 0x13, 0x1f, 0x00, 0x00, 0x00 },
+        .qll_features = { 0xff, 0xff, 0x1f, 0x0d, 0x00, 0x00, 0x00, 0x00 },
+        .qlmp_features = { 0xff, 0x01 },
+        .credits = 1,
+        .latency_us = 0,
+        .errors = {},
+        .error_count = 0,
+    };
+    return config;
+}
+
+// Answers the HCI commands qhs-util sends the way a QTI controller would,
+// and every other command with a zero-filled success so that the Linux
+// kernel can bring the emulated controller up. Commands and events are in
+// H4 framing, packet type byte first.
+class QtiEmulator {
+public:
+    explicit QtiEmulator(const qti_emu_config_t& config) : mConfig(config) {}
+
+    const qti_emu_config_t& config() const { return mConfig; }
+
+    // Builds the event answering `cmd` into `event` (which must hold
+    // QTI_EMU_MAX_EVENT_SIZE bytes) and returns its length, or 0 if `cmd`
+    // is not a well-formed command packet.
+    size_t handleCommand(const uint8_t* cmd, size_t len, uint8_t* event) const {
+        if (len < 4 || cmd[0] != H4_COMMAND_PKT || len < 4u + cmd[3]) {
+            return 0;
+        }
+
+        uint16_t opcode = cmd[1] | (cmd[2] << 8);
+        const uint8_t* params = cmd + 4;
+        uint8_t plen = cmd[3];
+        int sub_opcode = opcode == HCI_VS_QBCE_OCF && plen > 0 ? params[0] : QTI_EMU_ANY_SUB_OPCODE;
+
+        uint8_t status;
+        if (findError(opcode, sub_opcode, &status)) {
+            return commandStatus(event, opcode, status);
+        }
+
+        uint8_t* p = beginComplete(event, opcode);
+        switch (opcode) {
+        case HCI_READ_LOCAL_VERSION_OPCODE:
+            UINT8_TO_STREAM(p, HCI_SUCCESS);
+            UINT8_TO_STREAM(p, mConfig.hci_ver);
+            UINT16_TO_STREAM(p, mConfig.hci_rev);
+            UINT8_TO_STREAM(p, mConfig.lmp_ver);
+            UINT16_TO_STREAM(p, mConfig.manufacturer);
+            UINT16_TO_STREAM(p, mConfig.lmp_subver);
+            break;
+
+        case HCI_OCF_READ_BD_ADDR | (HCI_OGF_INFORMATIONAL << 10):
+            UINT8_TO_STREAM(p, HCI_SUCCESS);
+            memcpy(p, mConfig.bdaddr, sizeof(mConfig.bdaddr));
+            p += sizeof(mConfig.bdaddr);
+            break;
+
+        case HCI_OCF_READ_BUFFER_SIZE | (HCI_OGF_INFORMATIONAL << 10):
+            UINT8_TO_STREAM(p, HCI_SUCCESS);
+            UINT16_TO_STREAM(p, 1021);  // ACL MTU
+            UINT8_TO_STREAM(p, 64);     // SCO MTU
+            UINT16_TO_STREAM(p, 8);     // ACL packets
+            UINT16_TO_STREAM(p, 8);     // SCO packets
+            break;
+
+        case HCI_VS_GET_ADDON_FEATURES_SUPPORT:
+            UINT8_TO_STREAM(p, HCI_SUCCESS);
+            UINT16_TO_STREAM(p, mConfig.product_id);
+            UINT16_TO_STREAM(p, mConfig.response_version);
+            memcpy(p, mConfig.addon_features, sizeof(mConfig.addon_features));
+            p += sizeof(mConfig.addon_features);
+            break;
+
+        case HCI_VS_QBCE_OCF:
+            if (sub_opcode == HCI_VS_QBCE_READ_LOCAL_QLL_SUPPORTED_FEATURES) {
+                UINT8_TO_STREAM(p, HCI_SUCCESS);
+                UINT8_TO_STREAM(p, sub_opcode);
+                memcpy(p, mConfig.qll_features, sizeof(mConfig.qll_features));
+                p += sizeof(mConfig.qll_features);
+            } else if (sub_opcode == HCI_VS_QBCE_READ_LOCAL_QLM_SUPPORTED_FEATURES) {
+                UINT8_TO_STREAM(p, HCI_SUCCESS);
+                UINT8_TO_STREAM(p, sub_opcode);
+                memcpy(p, mConfig.qlmp_features, sizeof(mConfig.qlmp_features));
+                p += sizeof(mConfig.qlmp_features);
+            } else {
+                UINT8_TO_STREAM(p, HCI_ERR_UNKNOWN_HCI_COMMAND);
+            }
+            break;
+
+        default:
+            if ((opcode >> 10) == OGF_VS) {
+                UINT8_TO_STREAM(p, HCI_ERR_UNKNOWN_HCI_COMMAND);
+            } else {
+                // Long enough for the largest return parameters the kernel
+                // checks for (Read Local Name, 248 bytes)
+                UINT8_TO_STREAM(p, HCI_SUCCESS);
+                memset(p, 0, 248);
+                p += 248;
+            }
+            break;
+        }
+        return endComplete(event, p);
+    }
+
+private:
+    bool findError(uint16_t opcode, int sub_opcode, uint8_t* status) const {
+        for (size_t i = 0; i < mConfig.error_count; i++) {
+            const qti_emu_error_t& e = mConfig.errors[i];
+            if (e.opcode == opcode &&
+                (e.sub_opcode == QTI_EMU_ANY_SUB_OPCODE || e.sub_opcode == sub_opcode)) {
+                *status = e.status;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t commandStatus(uint8_t* event, uint16_t opcode, uint8_t status) const {
+        uint8_t* p = event;
+        UINT8_TO_STREAM(p, H4_EVENT_PKT);
+        UINT8_TO_STREAM(p, HCI_COMMAND_STATUS_EVT);
+        UINT8_TO_STREAM(p, 4);
+        UINT8_TO_STREAM(p, status);
+        UINT8_TO_STREAM(p, mConfig.credits);
+        UINT16_TO_STREAM(p, opcode);
+        return p - event;
+    }
+
+    uint8_t* beginComplete(uint8_t* event, uint16_t opcode) const {
+        uint8_t* p = event;
+        UINT8_TO_STREAM(p, H4_EVENT_PKT);
+        UINT8_TO_STREAM(p, HCI_COMMAND_COMPLETE_EVT);
+        UINT8_TO_STREAM(p, 0);  // length, filled in by endComplete()
+        UINT8_TO_STREAM(p, mConfig.credits);
+        UINT16_TO_STREAM(p, opcode);
+        return p;
+    }
+
+    size_t endComplete(uint8_t* event, uint8_t* end) const {
+        event[2] = end - event - 3;
+        return end - event;
+    }
+
+    qti_emu_config_t mConfig;
+};
+
+// Serves commands read from `fd` until it hits EOF or `stop` is set. Each
+// read must return exactly one H4 packet, as /dev/vhci and SOCK_SEQPACKET
+// sockets do. Every command is answered latency_us after it arrived, so
+// commands pipelined by the host overlap like they would on a controller.
+// Returns 0 on EOF or stop, -1 with errno set on I/O errors.
+inline int qti_emu_serve(int fd, const QtiEmulator& emu, const std::atomic<bool>& stop) {
+    using clock = std::chrono::steady_clock;
+
+    struct Response {
+        clock::time_point due;
+        size_t len;
+        uint8_t data[QTI_EMU_MAX_EVENT_SIZE];
+    };
+    // Latency is constant, so responses fall due in arrival order
+    Response queue[QTI_EMU_MAX_QUEUED];
+    size_t head = 0, tail = 0;
+    auto latency = std::chrono::microseconds(emu.config().latency_us);
+
+    while (!stop.load(std::memory_order_relaxed)) {
+        auto now = clock::now();
+        while (head != tail && queue[head % QTI_EMU_MAX_QUEUED].due <= now) {
+            Response& r = queue[head++ % QTI_EMU_MAX_QUEUED];
+            if (write(fd, r.data, r.len) < 0) {
+                return -1;
+            }
+        }
+
+        // Wake up for the next response due, and now and then to check `stop`
+        std::chrono::nanoseconds to = std::chrono::milliseconds(100);
+        if (head != tail) {
+            to = std::clamp<std::chrono::nanoseconds>(queue[head % QTI_EMU_MAX_QUEUED].due - now,
+                                                      std::chrono::nanoseconds(0), to);
+        }
+        if (tail - head == QTI_EMU_MAX_QUEUED) {
+            // Hold off reading until the oldest response has gone out
+            std::this_thread::sleep_until(queue[head % QTI_EMU_MAX_QUEUED].due);
+            continue;
+        }
+        struct pollfd pfd = { .fd = fd, .events = POLLIN, .revents = 0 };
+        // ppoll() rather than poll() for latencies below a millisecond
+        struct timespec ts = { .tv_sec = 0, .tv_nsec = (long) to.count() };
+        int n = ppoll(&pfd, 1, &ts, NULL);
+        if (n < 0 && errno != EINTR) {
+            return -1;
+        }
+        if (n <= 0) {
+            continue;
+        }
+
+        uint8_t cmd[QTI_EMU_MAX_COMMAND_SIZE];
+        ssize_t len = read(fd, cmd, sizeof(cmd));
+        if (len < 0 && (errno == EINTR || errno == EAGAIN)) {
+            continue;
+        } else if (len < 0) {
+            return -1;
+        } else if (len == 0) {
+            return 0;
+        }
+
+        Response& r = queue[tail % QTI_EMU_MAX_QUEUED];
+        r.len = emu.handleCommand(cmd, len, r.data);
+        if (r.len > 0) {
+            r.due = clock::now() + latency;
+            tail++;
+        }
+    }
+    return 0;
+}
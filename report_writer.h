@@ -0,0 +1,148 @@
+#pragma once
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <memory>
+
+#define REPORT_BUFFER_SIZE 65536
+
+#define REPORT_GREEN "\033[32m"
+#define REPORT_RED "\033[31m"
+#define REPORT_DEFAULT "\033[39m"
+
+// A feature bit and its name. Entries with a different `line` than the one
+// before start a new output line.
+typedef struct {
+    const char *name;
+    uint8_t bit;
+    uint8_t line;
+} feature_name_t;
+
+// Formats a whole report into one buffer allocated up front and hands it to
+// the kernel with a single write(), so reports of concurrent probes or
+// repeated runs never interleave and stdio is not involved. Features are
+// shown in green/red, or as +name/-name without colour. Whatever does not
+// fit into the buffer is cut off and marked as such.
+class ReportWriter {
+public:
+    explicit ReportWriter(bool colour)
+        : mBuf(new char[REPORT_BUFFER_SIZE]), mLen(0), mColour(colour), mTruncated(false) {}
+
+    ReportWriter(const ReportWriter&) = delete;
+    ReportWriter& operator=(const ReportWriter&) = delete;
+
+    __attribute__((format(printf, 2, 3)))
+    void printf(const char *fmt, ...) {
+        va_list args;
+        va_start(args, fmt);
+        size_t left = space();
+        int n = vsnprintf(mBuf.get() + mLen, left, fmt, args);
+        va_end(args);
+        if (n < 0) {
+            return;
+        }
+        if ((size_t) n >= left) {
+            mTruncated = true;
+            n = left > 0 ? left - 1 : 0;
+        }
+        mLen += n;
+    }
+
+    void append(const char *s, size_t len) {
+        if (len > space()) {
+            mTruncated = true;
+            len = space();
+        }
+        memcpy(mBuf.get() + mLen, s, len);
+        mLen += len;
+    }
+
+    void append(const char *s) { append(s, strlen(s)); }
+
+    // `prefix` then 0x.., 0x.. for every byte, and a newline
+    void hex(const char *prefix, const uint8_t *data, size_t len) {
+        static const char digits[] = "0123456789abcdef";
+        append(prefix);
+        for (size_t i = 0; i < len; i++) {
+            if (space() < 6) {
+                mTruncated = true;
+                break;
+            }
+            char *p = mBuf.get() + mLen;
+            if (i > 0) {
+                *p++ = ',';
+                *p++ = ' ';
+            }
+            *p++ = '0';
+            *p++ = 'x';
+            *p++ = digits[data[i] >> 4];
+            *p++ = digits[data[i] & 0xf];
+            mLen = p - mBuf.get();
+        }
+        append("\n", 1);
+    }
+
+    // The names from `table` of the bits in `bits`, set or not, comma
+    // separated and indented under the title
+    void features(const char *title, const uint8_t *bits, const feature_name_t *table, size_t count) {
+        append(title);
+        append(":\n    ");
+        for (size_t i = 0; i < count; i++) {
+            if (i > 0) {
+                append(table[i].line != table[i - 1].line ? ",\n    " : ", ");
+            }
+            bool set = bits[table[i].bit / 8] & (1 << (table[i].bit % 8));
+            if (mColour) {
+                append(set ? REPORT_GREEN : REPORT_RED);
+                append(table[i].name);
+                append(REPORT_DEFAULT);
+            } else {
+                append(set ? "+" : "-", 1);
+                append(table[i].name);
+            }
+        }
+        append("\n", 1);
+    }
+
+    size_t size() const { return mLen; }
+
+    // Writes out and empties the buffer. Returns -1 with errno set if the
+    // write failed.
+    int flush(int fd) {
+        if (mTruncated) {
+            // space() always keeps room for this
+            static const char marker[] = "[report truncated]\n";
+            memcpy(mBuf.get() + mLen, marker, sizeof(marker) - 1);
+            mLen += sizeof(marker) - 1;
+        }
+
+        size_t done = 0;
+        while (done < mLen) {
+            ssize_t n = write(fd, mBuf.get() + done, mLen - done);
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0) return -1;
+            done += n;
+        }
+        mLen = 0;
+        mTruncated = false;
+        return 0;
+    }
+
+private:
+    // Room left, keeping space for the truncation marker
+    size_t space() const {
+        size_t reserve = 32;
+        return mLen + reserve < REPORT_BUFFER_SIZE ? REPORT_BUFFER_SIZE - reserve - mLen : 0;
+    }
+
+    std::unique_ptr<char[]> mBuf;
+    size_t mLen;
+    bool mColour;
+    bool mTruncated;
+};
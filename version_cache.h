@@ -0,0 +1,97 @@
+#pragma once
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define VERSION_CACHE_MAGIC 0x51485331 /* QHS1 */
+#define VERSION_CACHE_DEFAULT_TTL_S 3600
+
+typedef struct {
+    uint32_t magic;
+    uint16_t manufacturer;
+    uint8_t hci_ver;
+    uint16_t hci_rev;
+    uint8_t lmp_ver;
+    uint16_t lmp_subver;
+} __attribute__((packed)) version_cache_entry_t;
+
+// Read Local Version results remembered across runs, one small file per
+// adapter in `dir`, named by a key that tells controllers apart (see
+// version_cache_key() in qhs-util.cpp). An entry is fresh for `ttl_s` seconds
+// after it was written. The controller version only changes with the
+// hardware, but the TTL bounds how long a swapped dongle with the same key
+// could be misreported.
+
+inline void version_cache_path(char *path, size_t size, const char *dir, const char *key) {
+    snprintf(path, size, "%s/%s.ver", dir, key);
+}
+
+// Returns 0 and fills `ver` if there is a fresh entry for `key`, -1 if not
+inline int version_cache_load(const char *dir, const char *key, int ttl_s,
+                              struct hci_version *ver) {
+    char path[256];
+    version_cache_path(path, sizeof(path), dir, key);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+
+    struct stat st;
+    version_cache_entry_t entry;
+    bool ok = fstat(fd, &st) == 0;
+    // An entry from the future, after the clock was stepped back at boot,
+    // is not fresh: its age would stay below the TTL for as long as the step
+    time_t age = ok ? time(NULL) - st.st_mtime : -1;
+    ok = ok && age >= 0 && age < ttl_s &&
+         read(fd, &entry, sizeof(entry)) == sizeof(entry) &&
+         entry.magic == VERSION_CACHE_MAGIC;
+    close(fd);
+    if (!ok) {
+        return -1;
+    }
+
+    ver->manufacturer = entry.manufacturer;
+    ver->hci_ver = entry.hci_ver;
+    ver->hci_rev = entry.hci_rev;
+    ver->lmp_ver = entry.lmp_ver;
+    ver->lmp_subver = entry.lmp_subver;
+    return 0;
+}
+
+// Replaces the entry for `key`. Written to a temporary file and renamed, so
+// a concurrent or interrupted run never reads half an entry.
+inline int version_cache_store(const char *dir, const char *key,
+                               const struct hci_version *ver) {
+    char path[256], tmp[272];
+    version_cache_path(path, sizeof(path), dir, key);
+    snprintf(tmp, sizeof(tmp), "%s.%d", path, getpid());
+
+    version_cache_entry_t entry = {
+        .magic = VERSION_CACHE_MAGIC,
+        .manufacturer = ver->manufacturer,
+        .hci_ver = ver->hci_ver,
+        .hci_rev = ver->hci_rev,
+        .lmp_ver = ver->lmp_ver,
+        .lmp_subver = ver->lmp_subver,
+    };
+
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+    bool ok = write(fd, &entry, sizeof(entry)) == sizeof(entry);
+    if (close(fd) < 0 || !ok || rename(tmp, path) < 0) {
+        int err = errno;
+        unlink(tmp);
+        errno = err;
+        return -1;
+    }
+    return 0;
+}